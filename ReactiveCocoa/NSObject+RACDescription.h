@@ -8,6 +8,18 @@
 
 #import <Foundation/Foundation.h>
 
+// Returns whether the RAC_DEBUG_SIGNAL_NAMES environment variable is set.
+//
+// The environment is only read once, so this is cheap enough to call whenever
+// a stream is created.
+extern BOOL RACDebugSignalNamesEnabled(void);
+
+// Overrides the value returned by RACDebugSignalNamesEnabled().
+//
+// This is only meant for use in tests, and should be invoked before any streams
+// are created.
+extern void RACSetDebugSignalNamesEnabled(BOOL enabled);
+
 // A private category providing a terser but faster alternative to -description.
 @interface NSObject (RACDescription)
 
@@ -9,10 +9,27 @@
 #import "NSObject+RACDescription.h"
 #import "RACTuple.h"
 
+static BOOL RACDebugSignalNamesEnabledValue;
+static dispatch_once_t RACDebugSignalNamesOnceToken;
+
+BOOL RACDebugSignalNamesEnabled(void) {
+	dispatch_once(&RACDebugSignalNamesOnceToken, ^{
+		RACDebugSignalNamesEnabledValue = (getenv("RAC_DEBUG_SIGNAL_NAMES") != NULL);
+	});
+
+	return RACDebugSignalNamesEnabledValue;
+}
+
+void RACSetDebugSignalNamesEnabled(BOOL enabled) {
+	// Make sure a later first call can't overwrite the override.
+	RACDebugSignalNamesEnabled();
+	RACDebugSignalNamesEnabledValue = enabled;
+}
+
 @implementation NSObject (RACDescription)
 
 - (NSString *)rac_description {
-	if (getenv("RAC_DEBUG_SIGNAL_NAMES") != NULL) {
+	if (RACDebugSignalNamesEnabled()) {
 		return [[NSString alloc] initWithFormat:@"<%@: %p>", self.class, self];
 	} else {
 		return @"(description skipped)";
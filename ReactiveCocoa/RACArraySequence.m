@@ -22,6 +22,14 @@
 
 @end
 
+// Enumerates the backing array of a RACArraySequence by index, without
+// creating any tail sequences.
+@interface RACArraySequenceEnumerator : NSEnumerator
+
+- (id)initWithArray:(NSArray *)array offset:(NSUInteger)offset;
+
+@end
+
 @implementation RACArraySequence
 
 #pragma mark Lifecycle
@@ -69,27 +77,17 @@
 
 	state->itemsPtr = stackbuf;
 
-	NSUInteger startIndex = state->state;
-	NSUInteger index = 0;
-
-	for (id value in self.backingArray) {
-		// Constructing an index set for -enumerateObjectsAtIndexes: can actually be
-		// slower than just skipping the items we don't care about.
-		if (index < startIndex) {
-			++index;
-			continue;
-		}
-
-		stackbuf[index - startIndex] = value;
+	// Copy straight out of the backing array, so enumeration doesn't need to
+	// skip over the values before the current index.
+	NSRange range = NSMakeRange(state->state, MIN(len, self.backingArray.count - state->state));
+	[self.backingArray getObjects:stackbuf range:range];
 
-		++index;
-		if (index - startIndex >= len) break;
-	}
-
-	NSCAssert(index > startIndex, @"Final index (%lu) should be greater than start index (%lu)", (unsigned long)index, (unsigned long)startIndex);
+	state->state = NSMaxRange(range);
+	return range.length;
+}
 
-	state->state = index;
-	return index - startIndex;
+- (NSEnumerator *)objectEnumerator {
+	return [[RACArraySequenceEnumerator alloc] initWithArray:self.backingArray offset:self.offset];
 }
 
 #pragma clang diagnostic push
@@ -123,3 +121,57 @@
 }
 
 @end
+
+@implementation RACArraySequenceEnumerator {
+	NSArray *_array;
+
+	// The index of the next object to return.
+	NSUInteger _index;
+}
+
+#pragma mark Lifecycle
+
+- (id)initWithArray:(NSArray *)array offset:(NSUInteger)offset {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_array = array;
+	_index = offset;
+
+	return self;
+}
+
+#pragma mark NSEnumerator
+
+- (id)nextObject {
+	if (_index >= _array.count) return nil;
+
+	return _array[_index++];
+}
+
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id[])stackbuf count:(NSUInteger)len {
+	NSCParameterAssert(len > 0);
+
+	if (state->state == 0) {
+		state->state = 1;
+
+		// The backing array doesn't mutate, so this just needs to be set to
+		// something non-NULL.
+		state->mutationsPtr = state->extra;
+	}
+
+	state->itemsPtr = stackbuf;
+
+	// Advance the receiver as well, so -nextObject picks up where fast
+	// enumeration left off.
+	NSRange range = NSMakeRange(_index, MIN(len, _array.count - MIN(_index, _array.count)));
+	[_array getObjects:stackbuf range:range];
+
+	_index = NSMaxRange(range);
+	return range.length;
+}
+
+@end
+
@@ -20,13 +20,15 @@
 // Profile any change!
 #define RACCompoundDisposableInlineCount 2
 
-static CFMutableArrayRef RACCreateDisposablesArray(void) {
-	// Compare values using only pointer equality.
-	CFArrayCallBacks callbacks = kCFTypeArrayCallBacks;
-	callbacks.equal = NULL;
+// The number of slots allocated the first time a compound disposable outgrows
+// its inline storage.
+#define RACCompoundDisposableInitialSlotCapacity 8
 
-	return CFArrayCreateMutable(NULL, 0, &callbacks);
-}
+// The minimum number of tombstoned slots before compaction will be considered.
+//
+// Compaction only happens once tombstones also make up at least half of the
+// used slots, so the cost is amortized over the removals that created them.
+#define RACCompoundDisposableCompactionThreshold 16
 
 @interface RACCompoundDisposable () {
 	// Used for synchronization.
@@ -35,18 +37,41 @@ static CFMutableArrayRef RACCreateDisposablesArray(void) {
 	#if RACCompoundDisposableInlineCount
 	// A fast array to the first N of the receiver's disposables.
 	//
-	// Once this is full, `_disposables` will be created and used for additional
+	// Once this is full, `_slots` will be created and used for additional
 	// disposables.
 	//
 	// This array should only be manipulated while _spinLock is held.
 	RACDisposable *_inlineDisposables[RACCompoundDisposableInlineCount];
 	#endif
 
-	// Contains the receiver's disposables.
+	// Contains the receiver's additional disposables, in the order they were
+	// added. Each non-NULL slot holds a retained disposable.
+	//
+	// Removed disposables leave a NULL tombstone behind, which is reclaimed by
+	// trimming the end of the array or by compaction.
 	//
 	// This array should only be manipulated while _spinLock is held. If
 	// `_disposed` is YES, this may be NULL.
-	CFMutableArrayRef _disposables;
+	const void **_slots;
+
+	// The number of slots in use (including tombstones), and the number
+	// allocated.
+	//
+	// These ivars should only be accessed while _spinLock is held.
+	NSUInteger _slotsCount;
+	NSUInteger _slotsCapacity;
+
+	// The number of tombstones within the first `_slotsCount` slots.
+	//
+	// This ivar should only be accessed while _spinLock is held.
+	NSUInteger _tombstoneCount;
+
+	// Maps each disposable in `_slots` (by pointer) to its index, so that
+	// removal doesn't need to search.
+	//
+	// This dictionary should only be manipulated while _spinLock is held. It
+	// is created lazily alongside `_slots`.
+	CFMutableDictionaryRef _slotIndexes;
 
 	// Whether the receiver has already been disposed.
 	//
@@ -58,6 +83,112 @@ static CFMutableArrayRef RACCreateDisposablesArray(void) {
 
 @implementation RACCompoundDisposable
 
+#pragma mark Slot Storage
+
+// Releases the first `count` slots of the given array, then frees it.
+static void RACReleaseSlots(const void **slots, NSUInteger count) {
+	if (slots == NULL) return;
+
+	for (NSUInteger i = 0; i < count; i++) {
+		if (slots[i] != NULL) CFRelease(slots[i]);
+	}
+
+	free(slots);
+}
+
+// Appends `disposable` to the slots of `compoundDisposable`, unless it's
+// already present there.
+//
+// This must only be invoked while _spinLock is held (or during initialization).
+static void RACAppendDisposable(RACCompoundDisposable *compoundDisposable, RACDisposable *disposable) {
+	if (compoundDisposable->_slotIndexes == NULL) {
+		// Keys are compared by pointer and not retained, since `_slots` already
+		// holds a reference to each of them.
+		compoundDisposable->_slotIndexes = CFDictionaryCreateMutable(NULL, 0, NULL, NULL);
+	}
+
+	const void *key = (__bridge void *)disposable;
+	if (CFDictionaryContainsKey(compoundDisposable->_slotIndexes, key)) return;
+
+	if (compoundDisposable->_slotsCount == compoundDisposable->_slotsCapacity) {
+		NSUInteger capacity = MAX(compoundDisposable->_slotsCapacity * 2, (NSUInteger)RACCompoundDisposableInitialSlotCapacity);
+		const void **slots = realloc(compoundDisposable->_slots, capacity * sizeof(*slots));
+		if (slots == NULL) {
+			// This is checked even in release builds, since carrying on would
+			// dereference NULL, or silently leak the disposable.
+			NSLog(@"Could not grow disposable storage of %@ to %lu slots", compoundDisposable, (unsigned long)capacity);
+			abort();
+		}
+
+		compoundDisposable->_slots = slots;
+		compoundDisposable->_slotsCapacity = capacity;
+	}
+
+	NSUInteger index = compoundDisposable->_slotsCount++;
+	compoundDisposable->_slots[index] = CFBridgingRetain(disposable);
+	CFDictionarySetValue(compoundDisposable->_slotIndexes, key, (const void *)(uintptr_t)index);
+}
+
+// Moves all live slots of `compoundDisposable` to the front of the array,
+// preserving their order, and updates their recorded indexes.
+//
+// This must only be invoked while _spinLock is held.
+static void RACCompactSlots(RACCompoundDisposable *compoundDisposable) {
+	const void **slots = compoundDisposable->_slots;
+	NSUInteger liveCount = 0;
+
+	for (NSUInteger i = 0; i < compoundDisposable->_slotsCount; i++) {
+		if (slots[i] == NULL) continue;
+
+		if (i != liveCount) {
+			slots[liveCount] = slots[i];
+			CFDictionarySetValue(compoundDisposable->_slotIndexes, slots[liveCount], (const void *)(uintptr_t)liveCount);
+		}
+
+		liveCount++;
+	}
+
+	compoundDisposable->_slotsCount = liveCount;
+	compoundDisposable->_tombstoneCount = 0;
+}
+
+// Removes `disposable` from the slots of `compoundDisposable`, if present.
+//
+// Returns the slot's reference to the disposable, which the caller must
+// release, or NULL if it wasn't found.
+//
+// This must only be invoked while _spinLock is held.
+static const void *RACRemoveDisposable(RACCompoundDisposable *compoundDisposable, RACDisposable *disposable) {
+	if (compoundDisposable->_slotIndexes == NULL) return NULL;
+
+	const void *key = (__bridge void *)disposable;
+	const void *indexValue = NULL;
+	if (!CFDictionaryGetValueIfPresent(compoundDisposable->_slotIndexes, key, &indexValue)) return NULL;
+
+	CFDictionaryRemoveValue(compoundDisposable->_slotIndexes, key);
+
+	const void **slots = compoundDisposable->_slots;
+	NSUInteger index = (NSUInteger)(uintptr_t)indexValue;
+
+	const void *removed = slots[index];
+	slots[index] = NULL;
+	compoundDisposable->_tombstoneCount++;
+
+	// Newer disposables are generally shorter-lived, so trailing tombstones are
+	// common and can be reclaimed right away.
+	while (compoundDisposable->_slotsCount > 0 && slots[compoundDisposable->_slotsCount - 1] == NULL) {
+		compoundDisposable->_slotsCount--;
+		compoundDisposable->_tombstoneCount--;
+	}
+
+	NSUInteger tombstoneCount = compoundDisposable->_tombstoneCount;
+	if (tombstoneCount >= RACCompoundDisposableCompactionThreshold && tombstoneCount * 2 >= compoundDisposable->_slotsCount) {
+		RACCompactSlots(compoundDisposable);
+	}
+
+	return removed;
+}
+
 #pragma mark Properties
 
 - (BOOL)isDisposed {
@@ -92,11 +223,8 @@ static CFMutableArrayRef RACCreateDisposablesArray(void) {
 	}];
 	#endif
 
-	if (otherDisposables.count > RACCompoundDisposableInlineCount) {
-		_disposables = RACCreateDisposablesArray();
-
-		CFRange range = CFRangeMake(RACCompoundDisposableInlineCount, (CFIndex)otherDisposables.count - RACCompoundDisposableInlineCount);
-		CFArrayAppendArray(_disposables, (__bridge CFArrayRef)otherDisposables, range);
+	for (NSUInteger i = RACCompoundDisposableInlineCount; i < otherDisposables.count; i++) {
+		RACAppendDisposable(self, otherDisposables[i]);
 	}
 
 	return self;
@@ -114,9 +242,12 @@ static CFMutableArrayRef RACCreateDisposablesArray(void) {
 	}
 	#endif
 
-	if (_disposables != NULL) {
-		CFRelease(_disposables);
-		_disposables = NULL;
+	RACReleaseSlots(_slots, _slotsCount);
+	_slots = NULL;
+
+	if (_slotIndexes != NULL) {
+		CFRelease(_slotIndexes);
+		_slotIndexes = NULL;
 	}
 }
 
@@ -142,11 +273,10 @@ static CFMutableArrayRef RACCreateDisposablesArray(void) {
 			}
 			#endif
 
-			if (_disposables == NULL) _disposables = RACCreateDisposablesArray();
-			CFArrayAppendValue(_disposables, (__bridge void *)disposable);
+			RACAppendDisposable(self, disposable);
 
 			if (RACCOMPOUNDDISPOSABLE_ADDED_ENABLED()) {
-				RACCOMPOUNDDISPOSABLE_ADDED(self.description.UTF8String, disposable.description.UTF8String, CFArrayGetCount(_disposables) + RACCompoundDisposableInlineCount);
+				RACCOMPOUNDDISPOSABLE_ADDED(self.description.UTF8String, disposable.description.UTF8String, _slotsCount - _tombstoneCount + RACCompoundDisposableInlineCount);
 			}
 
 		#if RACCompoundDisposableInlineCount
@@ -164,6 +294,8 @@ static CFMutableArrayRef RACCreateDisposablesArray(void) {
 - (void)removeDisposable:(RACDisposable *)disposable {
 	if (disposable == nil) return;
 
+	const void *removed = NULL;
+
 	OSSpinLockLock(&_spinLock);
 	{
 		if (!_disposed) {
@@ -173,37 +305,29 @@ static CFMutableArrayRef RACCreateDisposablesArray(void) {
 			}
 			#endif
 
-			if (_disposables != NULL) {
-				CFIndex count = CFArrayGetCount(_disposables);
-				for (CFIndex i = count - 1; i >= 0; i--) {
-					const void *item = CFArrayGetValueAtIndex(_disposables, i);
-					if (item == (__bridge void *)disposable) {
-						CFArrayRemoveValueAtIndex(_disposables, i);
-					}
-				}
+			removed = RACRemoveDisposable(self, disposable);
 
-				if (RACCOMPOUNDDISPOSABLE_REMOVED_ENABLED()) {
-					RACCOMPOUNDDISPOSABLE_REMOVED(self.description.UTF8String, disposable.description.UTF8String, CFArrayGetCount(_disposables) + RACCompoundDisposableInlineCount);
-				}
+			if (removed != NULL && RACCOMPOUNDDISPOSABLE_REMOVED_ENABLED()) {
+				RACCOMPOUNDDISPOSABLE_REMOVED(self.description.UTF8String, disposable.description.UTF8String, _slotsCount - _tombstoneCount + RACCompoundDisposableInlineCount);
 			}
 		}
 	}
 	OSSpinLockUnlock(&_spinLock);
+
+	// Released outside of the lock, since the disposable may deallocate.
+	if (removed != NULL) CFRelease(removed);
 }
 
 #pragma mark RACDisposable
 
-static void disposeEach(const void *value, void *context) {
-	RACDisposable *disposable = (__bridge id)value;
-	[disposable dispose];
-}
-
 - (void)dispose {
 	#if RACCompoundDisposableInlineCount
 	RACDisposable *inlineCopy[RACCompoundDisposableInlineCount];
 	#endif
 
-	CFArrayRef remainingDisposables = NULL;
+	const void **remainingSlots = NULL;
+	NSUInteger remainingCount = 0;
+	CFMutableDictionaryRef slotIndexes = NULL;
 
 	OSSpinLockLock(&_spinLock);
 	{
@@ -216,8 +340,15 @@ static void disposeEach(const void *value, void *context) {
 		}
 		#endif
 
-		remainingDisposables = _disposables;
-		_disposables = NULL;
+		remainingSlots = _slots;
+		remainingCount = _slotsCount;
+		slotIndexes = _slotIndexes;
+
+		_slots = NULL;
+		_slotsCount = 0;
+		_slotsCapacity = 0;
+		_tombstoneCount = 0;
+		_slotIndexes = NULL;
 	}
 	OSSpinLockUnlock(&_spinLock);
 
@@ -229,11 +360,15 @@ static void disposeEach(const void *value, void *context) {
 	}
 	#endif
 
-	if (remainingDisposables == NULL) return;
+	if (slotIndexes != NULL) CFRelease(slotIndexes);
+	if (remainingSlots == NULL) return;
+
+	for (NSUInteger i = 0; i < remainingCount; i++) {
+		RACDisposable *disposable = (__bridge id)remainingSlots[i];
+		[disposable dispose];
+	}
 
-	CFIndex count = CFArrayGetCount(remainingDisposables);
-	CFArrayApplyFunction(remainingDisposables, CFRangeMake(0, count), &disposeEach, NULL);
-	CFRelease(remainingDisposables);
+	RACReleaseSlots(remainingSlots, remainingCount);
 }
 
 @end
@@ -0,0 +1,64 @@
+//
+//  RACDemand.h
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "RACSubscriber.h"
+
+@class RACDisposable;
+
+/// Tracks how many more values a subscriber is willing to receive.
+///
+/// A subscriber opts into backpressure by returning a demand from
+/// -[RACSubscriber demand], then calling -request: as it becomes ready for more
+/// values. Sources which support demand will pause instead of sending values
+/// that haven't been requested. All other sources keep sending as usual, so
+/// a demand is a hint, not a filter.
+///
+/// This class is thread-safe.
+@interface RACDemand : NSObject
+
+/// The number of values which have been requested but not yet received.
+///
+/// Use of this property is discouraged outside of signal implementations, since
+/// it may change concurrently at any time.
+@property (atomic, assign, readonly) NSUInteger outstandingCount;
+
+/// Returns the demand of the given subscriber, or nil if the subscriber hasn't
+/// opted into backpressure.
++ (instancetype)demandForSubscriber:(id<RACSubscriber>)subscriber;
+
+/// Requests `count` more values.
+///
+/// If any blocks are waiting for demand (see -performWhenRequested:), they will
+/// be invoked synchronously on the calling thread.
+///
+/// count - The number of values to add to the outstanding demand. Requests
+///         saturate at NSUIntegerMax, which means that the demand is unbounded.
+- (void)request:(NSUInteger)count;
+
+/// Records that one requested value has been received.
+///
+/// This should be invoked by subscribers as they receive each value. If there is
+/// no outstanding demand (because the value was sent by a source which doesn't
+/// support backpressure), this does nothing.
+- (void)decrement;
+
+/// Invokes the given block once there is outstanding demand.
+///
+/// This is meant for use by signal implementations which need to wait for a
+/// request before sending their next value.
+///
+/// block - The block to invoke. If demand is already outstanding, this is
+///         invoked synchronously. Otherwise, it will be invoked on the thread
+///         which next calls -request:. This must not be nil.
+///
+/// Returns a disposable which can be used to cancel the block before it is
+/// invoked.
+- (RACDisposable *)performWhenRequested:(void (^)(void))block;
+
+@end
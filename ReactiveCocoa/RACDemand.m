@@ -0,0 +1,138 @@
+//
+//  RACDemand.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACDemand.h"
+#import "RACDisposable.h"
+#import <libkern/OSAtomic.h>
+
+@interface RACDemand () {
+	// Protects `_outstandingCount` and `_waiters`.
+	OSSpinLock _lock;
+
+	NSUInteger _outstandingCount;
+
+	// The disposables returned from -performWhenRequested: which have not yet
+	// been invoked or cancelled, in the order they were added.
+	//
+	// Each waiter is a RACDisposable, so that cancellation and invocation can
+	// race safely: whichever happens first wins.
+	NSMutableArray *_waiters;
+}
+
+@end
+
+@implementation RACDemand
+
+#pragma mark Lifecycle
+
++ (instancetype)demandForSubscriber:(id<RACSubscriber>)subscriber {
+	if (![subscriber respondsToSelector:@selector(demand)]) return nil;
+
+	return [subscriber demand];
+}
+
+- (id)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_lock = OS_SPINLOCK_INIT;
+	_waiters = [[NSMutableArray alloc] init];
+
+	return self;
+}
+
+#pragma mark Demand
+
+- (NSUInteger)outstandingCount {
+	OSSpinLockLock(&_lock);
+	NSUInteger count = _outstandingCount;
+	OSSpinLockUnlock(&_lock);
+
+	return count;
+}
+
+- (void)request:(NSUInteger)count {
+	if (count == 0) return;
+
+	NSArray *waiters = nil;
+
+	OSSpinLockLock(&_lock);
+	{
+		if (count > NSUIntegerMax - _outstandingCount) {
+			_outstandingCount = NSUIntegerMax;
+		} else {
+			_outstandingCount += count;
+		}
+
+		if (_waiters.count > 0) {
+			waiters = [_waiters copy];
+			[_waiters removeAllObjects];
+		}
+	}
+	OSSpinLockUnlock(&_lock);
+
+	// Invoke the waiters outside of the lock, since they'll most likely
+	// start sending values (and thus calling -decrement) immediately.
+	for (RACDisposable *waiter in waiters) {
+		[waiter dispose];
+	}
+}
+
+- (void)decrement {
+	OSSpinLockLock(&_lock);
+
+	// An unbounded demand never runs out.
+	if (_outstandingCount > 0 && _outstandingCount < NSUIntegerMax) _outstandingCount--;
+
+	OSSpinLockUnlock(&_lock);
+}
+
+- (RACDisposable *)performWhenRequested:(void (^)(void))block {
+	NSCParameterAssert(block != nil);
+
+	__block void (^pendingBlock)(void) = [block copy];
+	__block OSSpinLock pendingLock = OS_SPINLOCK_INIT;
+
+	// Invokes the block, unless it has already been invoked or cancelled.
+	RACDisposable *waiter = [RACDisposable disposableWithBlock:^{
+		OSSpinLockLock(&pendingLock);
+		void (^block)(void) = pendingBlock;
+		pendingBlock = nil;
+		OSSpinLockUnlock(&pendingLock);
+
+		if (block != nil) block();
+	}];
+
+	OSSpinLockLock(&_lock);
+	BOOL available = _outstandingCount > 0;
+	if (!available) [_waiters addObject:waiter];
+	OSSpinLockUnlock(&_lock);
+
+	if (available) {
+		[waiter dispose];
+		return [[RACDisposable alloc] init];
+	}
+
+	return [RACDisposable disposableWithBlock:^{
+		OSSpinLockLock(&pendingLock);
+		pendingBlock = nil;
+		OSSpinLockUnlock(&pendingLock);
+
+		OSSpinLockLock(&self->_lock);
+		[self->_waiters removeObjectIdenticalTo:waiter];
+		OSSpinLockUnlock(&self->_lock);
+	}];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> outstanding: %lu", self.class, self, (unsigned long)self.outstandingCount];
+}
+
+@end
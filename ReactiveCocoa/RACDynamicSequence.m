@@ -8,21 +8,106 @@
 
 #import "RACDynamicSequence.h"
 #import <libkern/OSAtomic.h>
+#import <pthread.h>
 
-// Determines how RACDynamicSequences will be deallocated before the next one is
-// shifted onto the autorelease pool.
+// Tails which are waiting to be released by the current thread.
 //
-// This avoids stack overflows when deallocating long chains of dynamic
-// sequences.
-#define DEALLOC_OVERFLOW_GUARD 100
+// Releasing a tail can deallocate it, which releases its own tail, and so on.
+// To avoid overflowing the stack on long chains, only the outermost dealloc on
+// each thread actually releases anything, and nested deallocs just add their
+// tail to the list.
+typedef struct {
+	// Whether a dealloc further up the stack is releasing pending tails.
+	BOOL draining;
+
+	// Retained tails, released in last-in, first-out order.
+	CFTypeRef *tails;
+	NSUInteger count;
+	NSUInteger capacity;
+} RACDynamicSequencePendingReleases;
+
+static void RACDynamicSequenceDestroyPendingReleases(void *value) {
+	RACDynamicSequencePendingReleases *pending = value;
+	free(pending->tails);
+	free(pending);
+}
+
+// Returns the pending releases of the current thread, or NULL if they could
+// not be allocated.
+static RACDynamicSequencePendingReleases *RACDynamicSequenceCurrentPendingReleases(void) {
+	static pthread_key_t key;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		pthread_key_create(&key, &RACDynamicSequenceDestroyPendingReleases);
+	});
+
+	RACDynamicSequencePendingReleases *pending = pthread_getspecific(key);
+	if (pending == NULL) {
+		pending = calloc(1, sizeof(*pending));
+		if (pending == NULL) return NULL;
+
+		pthread_setspecific(key, pending);
+	}
+
+	return pending;
+}
+
+// Releases `tail`, and any tails released as a result, without recursing.
+static void RACDynamicSequenceReleaseTail(CFTypeRef tail) {
+	RACDynamicSequencePendingReleases *pending = RACDynamicSequenceCurrentPendingReleases();
+	if (pending == NULL) {
+		// Releasing directly may recurse, but it's better than leaking the
+		// tail or dereferencing NULL.
+		CFRelease(tail);
+		return;
+	}
+
+	if (pending->count == pending->capacity) {
+		NSUInteger capacity = MAX(pending->capacity * 2, (NSUInteger)16);
+		CFTypeRef *tails = realloc(pending->tails, capacity * sizeof(*tails));
+		if (tails == NULL) {
+			// The existing tails are still valid, so just skip the queue.
+			CFRelease(tail);
+			return;
+		}
+
+		pending->tails = tails;
+		pending->capacity = capacity;
+	}
+
+	pending->tails[pending->count++] = tail;
+	if (pending->draining) return;
+
+	pending->draining = YES;
+
+	while (pending->count > 0) {
+		CFRelease(pending->tails[--pending->count]);
+	}
+
+	pending->draining = NO;
+}
+
+// Flags for `_evaluated`.
+enum {
+	RACDynamicSequenceHeadEvaluated = 1 << 0,
+	RACDynamicSequenceTailEvaluated = 1 << 1,
+};
 
 @interface RACDynamicSequence () {
+	// Which of `_head` and `_tail` have been evaluated.
+	//
+	// Once a flag is set, the corresponding ivar never changes again, so it
+	// can be read without synchronizing, after a memory barrier. Flags should
+	// only be set while synchronized on self.
+	volatile uint32_t _evaluated;
+
 	// The value for the "head" property, if it's been evaluated already.
 	//
 	// Because it's legal for head to be nil, this ivar is valid any time
 	// headBlock is nil.
 	//
-	// This ivar should only be accessed while synchronized on self.
+	// This ivar should only be accessed while synchronized on self, or after
+	// observing RACDynamicSequenceHeadEvaluated.
 	id _head;
 
 	// The value for the "tail" property, if it's been evaluated already.
@@ -30,7 +115,8 @@
 	// Because it's legal for tail to be nil, this ivar is valid any time
 	// tailBlock is nil.
 	//
-	// This ivar should only be accessed while synchronized on self.
+	// This ivar should only be accessed while synchronized on self, or after
+	// observing RACDynamicSequenceTailEvaluated.
 	RACSequence *_tail;
 
 	// The result of an evaluated `dependencyBlock`.
@@ -114,22 +200,25 @@
 }
 
 - (void)dealloc {
-	static volatile int32_t directDeallocCount = 0;
-
-	if (OSAtomicIncrement32(&directDeallocCount) >= DEALLOC_OVERFLOW_GUARD) {
-		OSAtomicAdd32(-DEALLOC_OVERFLOW_GUARD, &directDeallocCount);
+	if (_tail == nil) return;
 
-		// Put this sequence's tail onto the autorelease pool so we stop
-		// recursing.
-		__autoreleasing RACSequence *tail __attribute__((unused)) = _tail;
-	}
-	
+	// Hand our reference over to the pending releases, so that the tail is
+	// deallocated by the outermost dealloc instead of this one.
+	CFTypeRef tail = CFBridgingRetain(_tail);
 	_tail = nil;
+
+	RACDynamicSequenceReleaseTail(tail);
 }
 
 #pragma mark RACSequence
 
 - (id)head {
+	if ((_evaluated & RACDynamicSequenceHeadEvaluated) != 0) {
+		// Make sure we see the value which was stored before the flag.
+		OSMemoryBarrier();
+		return _head;
+	}
+
 	@synchronized (self) {
 		id untypedHeadBlock = self.headBlock;
 		if (untypedHeadBlock == nil) return _head;
@@ -148,11 +237,21 @@
 		}
 
 		self.headBlock = nil;
+
+		// Publish the value before the flag which allows unsynchronized reads.
+		OSAtomicOr32Barrier(RACDynamicSequenceHeadEvaluated, &_evaluated);
+
 		return _head;
 	}
 }
 
 - (RACSequence *)tail {
+	if ((_evaluated & RACDynamicSequenceTailEvaluated) != 0) {
+		// Make sure we see the value which was stored before the flag.
+		OSMemoryBarrier();
+		return _tail;
+	}
+
 	@synchronized (self) {
 		id untypedTailBlock = self.tailBlock;
 		if (untypedTailBlock == nil) return _tail;
@@ -173,6 +272,10 @@
 		if (_tail.name == nil) _tail.name = self.name;
 
 		self.tailBlock = nil;
+
+		// Publish the value before the flag which allows unsynchronized reads.
+		OSAtomicOr32Barrier(RACDynamicSequenceTailEvaluated, &_evaluated);
+
 		return _tail;
 	}
 }
@@ -10,6 +10,39 @@
 #import "NSObject+RACDescription.h"
 #import "RACArraySequence.h"
 
+// The number of chunks to split the work of each core into, so that cores
+// which finish early can pick up the slack.
+#define RACEagerSequenceChunksPerCore 4
+
+// Returns the most chunks that `count` values should be split into.
+static NSUInteger RACEagerSequenceMaximumChunkCount(NSUInteger count) {
+	return MIN(count, NSProcessInfo.processInfo.activeProcessorCount * RACEagerSequenceChunksPerCore);
+}
+
+// Splits `count` values into at most `maximumChunkCount` chunks, and invokes
+// `block` concurrently with the range of each chunk.
+//
+// Returns the number of chunks, which are numbered in order from zero.
+static NSUInteger RACEagerSequenceApplyInChunks(NSUInteger count, NSUInteger maximumChunkCount, void (^block)(NSUInteger chunk, NSRange range)) {
+	if (count == 0) return 0;
+
+	NSUInteger chunkCount = MIN(count, maximumChunkCount);
+	NSUInteger chunkLength = (count + chunkCount - 1) / chunkCount;
+
+	// Rounding the length up may have left the last chunks empty.
+	chunkCount = (count + chunkLength - 1) / chunkLength;
+
+	dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+		NSUInteger location = chunk * chunkLength;
+
+		@autoreleasepool {
+			block(chunk, NSMakeRange(location, MIN(chunkLength, count - location)));
+		}
+	});
+
+	return chunkCount;
+}
+
 @implementation RACEagerSequence
 
 #pragma mark RACStream
@@ -39,6 +72,19 @@
 	return [[self.class sequenceWithArray:resultArray offset:0] setNameWithFormat:@"[%@] -bind:", self.name];
 }
 
+- (instancetype)map:(id (^)(id value))block {
+	// Run the fused pipeline once, right away.
+	return [[super map:block].eagerSequence setNameWithFormat:@"[%@] -map:", self.name];
+}
+
+- (instancetype)filter:(BOOL (^)(id value))block {
+	return [[super filter:block].eagerSequence setNameWithFormat:@"[%@] -filter:", self.name];
+}
+
+- (instancetype)take:(NSUInteger)count {
+	return [[super take:count].eagerSequence setNameWithFormat:@"[%@] -take: %lu", self.name, (unsigned long)count];
+}
+
 - (instancetype)concat:(RACSequence *)sequence {
 	NSCParameterAssert(sequence != nil);
 	NSCParameterAssert([sequence isKindOfClass:RACSequence.class]);
@@ -49,6 +95,100 @@
 
 #pragma mark Extended methods
 
+- (RACSequence *)parallelMap:(id (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	NSArray *array = self.array;
+	NSUInteger count = array.count;
+
+	__unsafe_unretained id *values = (__unsafe_unretained id *)malloc(count * sizeof(*values));
+	[array getObjects:values range:NSMakeRange(0, count)];
+
+	// Each chunk writes to its own slots, so the results stay in order.
+	__strong id *results = (__strong id *)calloc(count, sizeof(*results));
+
+	RACEagerSequenceApplyInChunks(count, RACEagerSequenceMaximumChunkCount(count), ^(NSUInteger chunk, NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+			results[i] = block(values[i]);
+		}
+	});
+
+	NSMutableArray *resultArray = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger i = 0; i < count; i++) {
+		if (results[i] != nil) [resultArray addObject:results[i]];
+		results[i] = nil;
+	}
+
+	free(results);
+	free(values);
+
+	return [[self.class sequenceWithArray:resultArray offset:0] setNameWithFormat:@"[%@] -parallelMap:", self.name];
+}
+
+- (RACSequence *)parallelFilter:(BOOL (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	NSArray *array = self.array;
+	NSUInteger count = array.count;
+
+	__unsafe_unretained id *values = (__unsafe_unretained id *)malloc(count * sizeof(*values));
+	[array getObjects:values range:NSMakeRange(0, count)];
+
+	BOOL *passed = malloc(count * sizeof(*passed));
+
+	RACEagerSequenceApplyInChunks(count, RACEagerSequenceMaximumChunkCount(count), ^(NSUInteger chunk, NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+			passed[i] = block(values[i]);
+		}
+	});
+
+	NSMutableArray *resultArray = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger i = 0; i < count; i++) {
+		if (passed[i]) [resultArray addObject:values[i]];
+	}
+
+	free(passed);
+	free(values);
+
+	return [[self.class sequenceWithArray:resultArray offset:0] setNameWithFormat:@"[%@] -parallelFilter:", self.name];
+}
+
+- (id)parallelReduceWithIdentity:(id)identity combine:(id (^)(id, id))combine {
+	NSCParameterAssert(combine != nil);
+
+	NSArray *array = self.array;
+	NSUInteger count = array.count;
+	if (count == 0) return identity;
+
+	__unsafe_unretained id *values = (__unsafe_unretained id *)malloc(count * sizeof(*values));
+	[array getObjects:values range:NSMakeRange(0, count)];
+
+	NSUInteger maximumChunkCount = RACEagerSequenceMaximumChunkCount(count);
+	__strong id *chunkResults = (__strong id *)calloc(maximumChunkCount, sizeof(*chunkResults));
+
+	NSUInteger chunkCount = RACEagerSequenceApplyInChunks(count, maximumChunkCount, ^(NSUInteger chunk, NSRange range) {
+		id accumulator = identity;
+		for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+			accumulator = combine(accumulator, values[i]);
+		}
+
+		chunkResults[chunk] = accumulator;
+	});
+
+	// Combine the chunks in order, so the result is deterministic even if
+	// `combine` isn't commutative.
+	id result = identity;
+	for (NSUInteger i = 0; i < chunkCount; i++) {
+		result = combine(result, chunkResults[i]);
+		chunkResults[i] = nil;
+	}
+
+	free(chunkResults);
+	free(values);
+
+	return result;
+}
+
 - (RACSequence *)eagerSequence {
 	return self;
 }
@@ -58,9 +198,17 @@
 }
 
 - (id)foldRightWithStart:(id)start reduce:(id (^)(id, RACSequence *rest))reduce {
-	return [super foldRightWithStart:start reduce:^(id first, RACSequence *rest) {
-		return reduce(first, rest.eagerSequence);
-	}];
+	NSCParameterAssert(reduce != NULL);
+
+	// Every `rest` is evaluated eagerly anyway, so fold from the right instead
+	// of recursing once for each value.
+	id result = start;
+	for (id value in self.array.reverseObjectEnumerator) {
+		RACSequence *rest = [self.class sequenceWithArray:(result != nil ? @[ result ] : @[]) offset:0];
+		result = reduce(value, rest);
+	}
+
+	return result;
 }
 
 @end
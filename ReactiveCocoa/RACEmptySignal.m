@@ -22,6 +22,14 @@
 #endif
 }
 
+- (instancetype)setNameWithBlock:(NSString * (^)(void))block {
+#ifdef DEBUG
+	return [super setNameWithBlock:block];
+#else
+	return self;
+#endif
+}
+
 - (NSString *)name {
 #ifdef DEBUG
 	return super.name;
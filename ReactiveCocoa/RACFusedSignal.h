@@ -0,0 +1,38 @@
+//
+//  RACFusedSignal.h
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACSignal.h"
+
+// A single step in the chain of a fused signal.
+//
+// value - The value received from the previous stage.
+// skip  - Set to YES to drop the value, in which case the return value is
+//         ignored and later stages won't be invoked.
+// stop  - Set to YES to complete the signal once this value has been handled.
+//
+// Returns the value to pass on to the next stage.
+typedef id (^RACFusedStage)(id value, BOOL *skip, BOOL *stop);
+
+// A private `RACSignal` subclass that passes the values of another signal
+// through a chain of synchronous stages, like those of -map: and -filter:.
+//
+// Adding a stage to a fused signal creates a new fused signal with a longer
+// chain, instead of another layer of subscriptions, so the whole chain runs
+// inline with one subscriber and one disposable.
+@interface RACFusedSignal : RACSignal
+
+// Returns a signal which passes the values of `signal` through a stage created
+// by `stageFactory`.
+//
+// signal       - The signal to transform. If this is a fused signal, its chain
+//                is extended instead. This must not be nil.
+// stageFactory - Invoked once per subscription to create the stage, so that
+//                stages can keep their own state. This must not be nil.
++ (RACSignal *)signalWithSignal:(RACSignal *)signal stage:(RACFusedStage (^)(void))stageFactory;
+
+@end
@@ -0,0 +1,111 @@
+//
+//  RACFusedSignal.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACFusedSignal.h"
+#import "RACCompoundDisposable.h"
+#import "RACPassthroughSubscriber.h"
+#import "RACScheduler+Private.h"
+#import "RACSubscriber+Private.h"
+
+@interface RACFusedSignal ()
+
+// The signal whose values are passed through the chain.
+@property (nonatomic, strong, readonly) RACSignal *sourceSignal;
+
+// The blocks which create each stage of the chain, in order.
+@property (nonatomic, copy, readonly) NSArray *stageFactories;
+
+@end
+
+@implementation RACFusedSignal
+
+#pragma mark Lifecycle
+
++ (RACSignal *)signalWithSignal:(RACSignal *)signal stage:(RACFusedStage (^)(void))stageFactory {
+	NSCParameterAssert(signal != nil);
+	NSCParameterAssert(stageFactory != nil);
+
+	stageFactory = [stageFactory copy];
+
+	RACFusedSignal *fused = [[self alloc] init];
+	if ([signal isKindOfClass:RACFusedSignal.class]) {
+		RACFusedSignal *previous = (id)signal;
+		fused->_sourceSignal = previous.sourceSignal;
+		fused->_stageFactories = [previous.stageFactories arrayByAddingObject:stageFactory];
+	} else {
+		fused->_sourceSignal = signal;
+		fused->_stageFactories = @[ stageFactory ];
+	}
+
+	return fused;
+}
+
+#pragma mark Managing Subscribers
+
+// Creates the stages for a new subscription, and composes them into one.
+- (RACFusedStage)chainForSubscription {
+	RACFusedStage chain = nil;
+
+	for (RACFusedStage (^stageFactory)(void) in self.stageFactories) {
+		RACFusedStage stage = stageFactory();
+		if (chain == nil) {
+			chain = stage;
+			continue;
+		}
+
+		RACFusedStage previous = chain;
+		chain = ^ id (id value, BOOL *skip, BOOL *stop) {
+			value = previous(value, skip, stop);
+			if (*skip) return nil;
+
+			return stage(value, skip, stop);
+		};
+	}
+
+	return chain;
+}
+
+- (RACDisposable *)subscribe:(id<RACSubscriber>)subscriber {
+	NSCParameterAssert(subscriber != nil);
+
+	RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
+	subscriber = [[RACPassthroughSubscriber alloc] initWithSubscriber:subscriber signal:self disposable:disposable];
+
+	RACFusedStage chain = [self chainForSubscription];
+
+	RACSubscriber *sourceSubscriber = [RACSubscriber subscriberWithNext:^(id x) {
+		// Manually check disposal to handle synchronous values after a stage
+		// has stopped the chain.
+		if (disposable.disposed) return;
+
+		BOOL skip = NO;
+		BOOL stop = NO;
+		id value = chain(x, &skip, &stop);
+
+		if (!skip) [subscriber sendNext:value];
+
+		if (stop) {
+			[subscriber sendCompleted];
+			[disposable dispose];
+		}
+	} error:^(NSError *error) {
+		[subscriber sendError:error];
+	} completed:^{
+		[subscriber sendCompleted];
+	}];
+
+	RACDisposable *schedulingDisposable = [RACScheduler.subscriptionScheduler schedule:^{
+		RACDisposable *sourceDisposable = [self.sourceSignal subscribe:sourceSubscriber];
+		[disposable addDisposable:sourceDisposable];
+	}];
+
+	[disposable addDisposable:schedulingDisposable];
+	return disposable;
+}
+
+@end
@@ -8,6 +8,7 @@
 
 #import "RACImmediateScheduler.h"
 #import "RACScheduler+Private.h"
+#import <libkern/OSAtomic.h>
 
 @implementation RACImmediateScheduler
 
@@ -36,16 +37,56 @@
 	return nil;
 }
 
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	NSCParameterAssert(block != NULL);
+
+	[NSThread sleepForTimeInterval:(NSTimeInterval)delay / NSEC_PER_SEC];
+	block();
+
+	return nil;
+}
+
 - (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
 	NSCAssert(NO, @"+[RACScheduler immediateScheduler] does not support %@.", NSStringFromSelector(_cmd));
 	return nil;
 }
 
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSCAssert(NO, @"+[RACScheduler immediateScheduler] does not support %@.", NSStringFromSelector(_cmd));
+	return nil;
+}
+
 - (RACDisposable *)scheduleRecursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock {
-	for (__block NSUInteger remaining = 1; remaining > 0; remaining--) {
-		recursiveBlock(^{
-			remaining++;
-		});
+	recursiveBlock = [recursiveBlock copy];
+
+	// Protects the variables below, since the block may reschedule from
+	// another thread (e.g., after waiting for demand).
+	__block OSSpinLock lock = OS_SPINLOCK_INIT;
+
+	__block NSUInteger remaining = 1;
+
+	// Set to NO once the loop below has finished. Further rescheduling should
+	// start a new loop, rather than being flattened into this one.
+	__block BOOL looping = YES;
+
+	void (^reschedule)(void) = ^{
+		OSSpinLockLock(&lock);
+		BOOL flatten = looping;
+		if (flatten) remaining++;
+		OSSpinLockUnlock(&lock);
+
+		if (!flatten) [self scheduleRecursiveBlock:recursiveBlock];
+	};
+
+	while (YES) {
+		recursiveBlock(reschedule);
+
+		OSSpinLockLock(&lock);
+		looping = --remaining > 0;
+		BOOL again = looping;
+		OSSpinLockUnlock(&lock);
+
+		if (!again) break;
 	}
 
 	return nil;
@@ -0,0 +1,56 @@
+//
+//  RACMetrics+Private.h
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACMetrics.h"
+
+// The kinds of object which metrics are recorded for.
+typedef enum : NSUInteger {
+	RACMetricsKindSignal,
+	RACMetricsKindScheduler,
+} RACMetricsKind;
+
+// The kinds of callback which can be recorded.
+typedef enum : NSUInteger {
+	RACMetricsEventNext,
+	RACMetricsEventError,
+	RACMetricsEventCompleted,
+
+	// A block run by a scheduler.
+	RACMetricsEventScheduled,
+} RACMetricsEvent;
+
+// Returns whether metrics are currently being recorded.
+extern BOOL RACMetricsEnabled(void);
+
+// Returns the slot under which metrics for the given name should be recorded.
+//
+// This takes a global lock, so should be invoked once per subscription (or
+// object) rather than once per event.
+//
+// kind - The kind of object being recorded.
+// name - The name to record metrics under. This must not be nil.
+//
+// Returns a slot to pass to the recording functions, or 0 if too many names
+// have already been registered.
+extern NSUInteger RACMetricsSlotForName(RACMetricsKind kind, NSString *name);
+
+// Returns the current time, in monotonic nanoseconds, for measuring durations.
+extern uint64_t RACMetricsTimestamp(void);
+
+// Records that a subscription was made or disposed.
+//
+// slot       - A slot from RACMetricsSlotForName(). If 0, this does nothing.
+// subscribed - Whether the subscription was made (YES) or disposed (NO).
+extern void RACMetricsRecordSubscription(NSUInteger slot, BOOL subscribed);
+
+// Records a callback, and how long it took.
+//
+// slot     - A slot from RACMetricsSlotForName(). If 0, this does nothing.
+// event    - The kind of callback.
+// duration - The duration of the callback, in nanoseconds.
+extern void RACMetricsRecordEvent(NSUInteger slot, RACMetricsEvent event, uint64_t duration);
@@ -0,0 +1,106 @@
+//
+//  RACMetrics.h
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RACMetricsSnapshot;
+
+/// Collects event counts and callback latencies for every signal and scheduler,
+/// to help find the hot spots in a large signal graph without attaching DTrace.
+///
+/// Metrics are disabled by default. Once enabled, each subscription made to
+/// a signal is recorded under the signal's name, or its class name if it hasn't
+/// been named. Set the `RAC_DEBUG_SIGNAL_NAMES` environment variable, or name
+/// signals explicitly with -setNameWithFormat:, to get more specific keys.
+///
+/// Blocks run by schedulers are recorded under the scheduler's name.
+///
+/// Each thread records into its own storage, so recording never contends with
+/// other threads. Snapshots sum the storage of every thread, and so may miss
+/// events which are being recorded concurrently.
+@interface RACMetrics : NSObject
+
+/// Whether metrics are currently being recorded.
+///
+/// Subscriptions made while metrics are disabled are never recorded, even if
+/// metrics are enabled later.
++ (BOOL)isEnabled;
++ (void)setEnabled:(BOOL)enabled;
+
+/// Returns the metrics recorded since the last call to +reset.
++ (RACMetricsSnapshot *)snapshot;
+
+/// Discards all recorded metrics.
++ (void)reset;
+
+@end
+
+/// The metrics recorded for a single signal or scheduler.
+@interface RACMetricsEntry : NSObject
+
+/// The name of the signal or scheduler.
+@property (nonatomic, copy, readonly) NSString *name;
+
+/// The number of `next` events sent to subscribers.
+@property (nonatomic, assign, readonly) uint64_t nextCount;
+
+/// The number of `error` events sent to subscribers.
+@property (nonatomic, assign, readonly) uint64_t errorCount;
+
+/// The number of `completed` events sent to subscribers.
+@property (nonatomic, assign, readonly) uint64_t completedCount;
+
+/// The number of subscriptions which have not yet been disposed.
+@property (nonatomic, assign, readonly) uint64_t subscriberCount;
+
+/// The total number of subscriptions made.
+@property (nonatomic, assign, readonly) uint64_t subscriptionCount;
+
+/// The number of callbacks which were timed.
+///
+/// For signals, this is the number of events sent. For schedulers, this is the
+/// number of times that blocks were run, which may include several blocks at
+/// once for schedulers which run in batches, like RACThreadScheduler.
+@property (nonatomic, assign, readonly) uint64_t callbackCount;
+
+/// The total time spent in callbacks, including any work which they performed
+/// synchronously (like sending events to downstream subscribers).
+@property (nonatomic, assign, readonly) NSTimeInterval totalCallbackDuration;
+
+/// The longest time spent in a single callback.
+@property (nonatomic, assign, readonly) NSTimeInterval maximumCallbackDuration;
+
+/// Returns the time within which the given fraction of callbacks completed.
+///
+/// Durations are recorded in a histogram with four buckets per power of two, so
+/// the result is an upper bound which is within 25% of the exact value.
+///
+/// percentile - A value between 0 and 1, such as 0.99 for the 99th percentile.
+- (NSTimeInterval)callbackDurationAtPercentile:(double)percentile;
+
+/// Returns a JSON-compatible representation of the receiver.
+- (NSDictionary *)dictionaryRepresentation;
+
+@end
+
+/// A point-in-time copy of all recorded metrics.
+@interface RACMetricsSnapshot : NSObject
+
+/// The metrics of each signal, keyed by name.
+@property (nonatomic, copy, readonly) NSDictionary *signals;
+
+/// The metrics of each scheduler, keyed by name.
+@property (nonatomic, copy, readonly) NSDictionary *schedulers;
+
+/// Returns a JSON-compatible representation of the receiver.
+- (NSDictionary *)dictionaryRepresentation;
+
+/// Returns the receiver serialized as JSON.
+- (NSData *)JSONData;
+
+@end
@@ -0,0 +1,530 @@
+//
+//  RACMetrics.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACMetrics+Private.h"
+#import "RACScheduler+Private.h"
+#import <libkern/OSAtomic.h>
+#import <pthread.h>
+
+// Durations are recorded in a log-linear histogram, with four buckets for each
+// power of two up to this exponent. Anything longer (about 18 minutes) goes
+// into the last bucket.
+#define RACMetricsMaximumExponent 39
+#define RACMetricsBucketCount ((RACMetricsMaximumExponent - 1) * 4 + 4)
+
+// Slots are stored in pages, so that a thread's storage only grows with the
+// slots it actually records into.
+#define RACMetricsPageSize 256
+#define RACMetricsPageCount 256
+
+// The counters recorded by one thread for one slot.
+typedef struct {
+	uint64_t nextCount;
+	uint64_t errorCount;
+	uint64_t completedCount;
+
+	// May be negative, since subscriptions are often disposed on a different
+	// thread than the one they were made on.
+	int64_t subscriberCount;
+	uint64_t subscriptionCount;
+
+	uint64_t callbackCount;
+	uint64_t totalDuration;
+	uint64_t maximumDuration;
+	uint64_t buckets[RACMetricsBucketCount];
+} RACMetricsCounters;
+
+// The metrics recorded by one thread.
+//
+// Only the owning thread writes to this storage. Other threads read it while
+// holding RACMetricsLock, which the owning thread also takes before freeing it.
+typedef struct RACMetricsThreadStorage {
+	struct RACMetricsThreadStorage *next;
+
+	// The value of RACMetricsEpoch when this storage was last cleared.
+	int64_t epoch;
+
+	// Pages of RACMetricsPageSize counter pointers, allocated as needed.
+	RACMetricsCounters **pages[RACMetricsPageCount];
+} RACMetricsThreadStorage;
+
+// Protects the slot registry and the list of thread storage.
+static OSSpinLock RACMetricsLock = OS_SPINLOCK_INIT;
+
+// The storage of every live thread which has recorded metrics, linked through
+// `next`. This should only be used while RACMetricsLock is held.
+static RACMetricsThreadStorage *RACMetricsThreads = NULL;
+
+// The metrics of threads which have exited. This should only be used while
+// RACMetricsLock is held.
+static RACMetricsThreadStorage RACMetricsRetired;
+
+// The names and kinds of each slot, indexed by slot. Slot 0 is never used.
+// These should only be used while RACMetricsLock is held.
+static NSMutableArray *RACMetricsSlotNames = nil;
+static NSMutableArray *RACMetricsSlotKinds = nil;
+
+// Maps names to slots, for each RACMetricsKind. This should only be used while
+// RACMetricsLock is held.
+static NSMutableDictionary *RACMetricsSlotsByKind[2];
+
+// Incremented by +reset. Thread storage from an earlier epoch is stale, and
+// will be cleared by its thread before recording anything else.
+static volatile int64_t RACMetricsEpoch = 0;
+
+static volatile int32_t RACMetricsEnabledFlag = 0;
+
+static pthread_key_t RACMetricsStorageKey;
+
+// Returns the index of the histogram bucket for the given duration.
+static NSUInteger RACMetricsBucketIndex(uint64_t value) {
+	if (value < 4) return (NSUInteger)value;
+
+	NSUInteger exponent = 63 - (NSUInteger)__builtin_clzll(value);
+	if (exponent > RACMetricsMaximumExponent) return RACMetricsBucketCount - 1;
+
+	return (exponent - 1) * 4 + (NSUInteger)((value >> (exponent - 2)) & 3);
+}
+
+// Returns the smallest duration which is too long for the given bucket.
+static uint64_t RACMetricsBucketUpperBound(NSUInteger index) {
+	if (index < 4) return index + 1;
+
+	NSUInteger exponent = index / 4 + 1;
+	return (uint64_t)(4 + index % 4 + 1) << (exponent - 2);
+}
+
+static void RACMetricsCountersAdd(RACMetricsCounters *counters, const RACMetricsCounters *other) {
+	counters->nextCount += other->nextCount;
+	counters->errorCount += other->errorCount;
+	counters->completedCount += other->completedCount;
+	counters->subscriberCount += other->subscriberCount;
+	counters->subscriptionCount += other->subscriptionCount;
+	counters->callbackCount += other->callbackCount;
+	counters->totalDuration += other->totalDuration;
+	counters->maximumDuration = MAX(counters->maximumDuration, other->maximumDuration);
+
+	for (NSUInteger i = 0; i < RACMetricsBucketCount; i++) {
+		counters->buckets[i] += other->buckets[i];
+	}
+}
+
+// Invokes `block` with each slot which has been recorded into `storage`.
+static void RACMetricsStorageEnumerate(RACMetricsThreadStorage *storage, void (^block)(NSUInteger slot, RACMetricsCounters *counters)) {
+	for (NSUInteger pageIndex = 0; pageIndex < RACMetricsPageCount; pageIndex++) {
+		RACMetricsCounters **page = storage->pages[pageIndex];
+		if (page == NULL) continue;
+
+		for (NSUInteger i = 0; i < RACMetricsPageSize; i++) {
+			RACMetricsCounters *counters = page[i];
+			if (counters != NULL) block(pageIndex * RACMetricsPageSize + i, counters);
+		}
+	}
+}
+
+static void RACMetricsStorageClear(RACMetricsThreadStorage *storage) {
+	RACMetricsStorageEnumerate(storage, ^(NSUInteger slot, RACMetricsCounters *counters) {
+		memset(counters, 0, sizeof(*counters));
+	});
+}
+
+static void RACMetricsStorageFree(RACMetricsThreadStorage *storage) {
+	for (NSUInteger pageIndex = 0; pageIndex < RACMetricsPageCount; pageIndex++) {
+		RACMetricsCounters **page = storage->pages[pageIndex];
+		if (page == NULL) continue;
+
+		for (NSUInteger i = 0; i < RACMetricsPageSize; i++) {
+			free(page[i]);
+		}
+
+		free(page);
+	}
+}
+
+// Returns the counters for `slot` in `storage`, allocating them if necessary.
+//
+// Pointers are published with a barrier, so that a concurrent snapshot never
+// sees uninitialized memory.
+static RACMetricsCounters *RACMetricsStorageCounters(RACMetricsThreadStorage *storage, NSUInteger slot) {
+	RACMetricsCounters **page = storage->pages[slot / RACMetricsPageSize];
+	if (page == NULL) {
+		page = calloc(RACMetricsPageSize, sizeof(*page));
+		OSMemoryBarrier();
+		storage->pages[slot / RACMetricsPageSize] = page;
+	}
+
+	RACMetricsCounters *counters = page[slot % RACMetricsPageSize];
+	if (counters == NULL) {
+		counters = calloc(1, sizeof(*counters));
+		OSMemoryBarrier();
+		page[slot % RACMetricsPageSize] = counters;
+	}
+
+	return counters;
+}
+
+// Moves the metrics of an exiting thread into RACMetricsRetired.
+static void RACMetricsThreadStorageDestroy(void *value) {
+	RACMetricsThreadStorage *storage = value;
+
+	OSSpinLockLock(&RACMetricsLock);
+	{
+		RACMetricsThreadStorage **link = &RACMetricsThreads;
+		while (*link != storage) {
+			link = &(*link)->next;
+		}
+
+		*link = storage->next;
+
+		if (storage->epoch == RACMetricsEpoch) {
+			RACMetricsStorageEnumerate(storage, ^(NSUInteger slot, RACMetricsCounters *counters) {
+				RACMetricsCountersAdd(RACMetricsStorageCounters(&RACMetricsRetired, slot), counters);
+			});
+		}
+	}
+	OSSpinLockUnlock(&RACMetricsLock);
+
+	RACMetricsStorageFree(storage);
+	free(storage);
+}
+
+// Returns the current thread's storage, creating it if necessary.
+static RACMetricsThreadStorage *RACMetricsCurrentStorage(void) {
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		pthread_key_create(&RACMetricsStorageKey, &RACMetricsThreadStorageDestroy);
+	});
+
+	RACMetricsThreadStorage *storage = pthread_getspecific(RACMetricsStorageKey);
+	if (storage == NULL) {
+		storage = calloc(1, sizeof(*storage));
+
+		OSSpinLockLock(&RACMetricsLock);
+		storage->epoch = RACMetricsEpoch;
+		storage->next = RACMetricsThreads;
+		RACMetricsThreads = storage;
+		OSSpinLockUnlock(&RACMetricsLock);
+
+		pthread_setspecific(RACMetricsStorageKey, storage);
+	} else if (storage->epoch != RACMetricsEpoch) {
+		int64_t epoch = RACMetricsEpoch;
+		RACMetricsStorageClear(storage);
+
+		// Snapshots ignore stale storage, so only mark it current once it's
+		// actually been cleared.
+		OSMemoryBarrier();
+		storage->epoch = epoch;
+	}
+
+	return storage;
+}
+
+BOOL RACMetricsEnabled(void) {
+	return RACMetricsEnabledFlag != 0;
+}
+
+NSUInteger RACMetricsSlotForName(RACMetricsKind kind, NSString *name) {
+	NSCParameterAssert(kind == RACMetricsKindSignal || kind == RACMetricsKindScheduler);
+	NSCParameterAssert(name != nil);
+
+	NSUInteger slot = 0;
+
+	OSSpinLockLock(&RACMetricsLock);
+	{
+		if (RACMetricsSlotNames == nil) {
+			RACMetricsSlotNames = [NSMutableArray arrayWithObject:NSNull.null];
+			RACMetricsSlotKinds = [NSMutableArray arrayWithObject:NSNull.null];
+			RACMetricsSlotsByKind[RACMetricsKindSignal] = [NSMutableDictionary dictionary];
+			RACMetricsSlotsByKind[RACMetricsKindScheduler] = [NSMutableDictionary dictionary];
+		}
+
+		NSNumber *existingSlot = RACMetricsSlotsByKind[kind][name];
+		if (existingSlot != nil) {
+			slot = existingSlot.unsignedIntegerValue;
+		} else if (RACMetricsSlotNames.count < RACMetricsPageSize * RACMetricsPageCount) {
+			slot = RACMetricsSlotNames.count;
+
+			name = [name copy];
+			[RACMetricsSlotNames addObject:name];
+			[RACMetricsSlotKinds addObject:@(kind)];
+			RACMetricsSlotsByKind[kind][name] = @(slot);
+		}
+	}
+	OSSpinLockUnlock(&RACMetricsLock);
+
+	return slot;
+}
+
+uint64_t RACMetricsTimestamp(void) {
+	return RACSchedulerMonotonicTime();
+}
+
+void RACMetricsRecordSubscription(NSUInteger slot, BOOL subscribed) {
+	if (slot == 0) return;
+
+	RACMetricsCounters *counters = RACMetricsStorageCounters(RACMetricsCurrentStorage(), slot);
+	if (subscribed) {
+		counters->subscriberCount++;
+		counters->subscriptionCount++;
+	} else {
+		counters->subscriberCount--;
+	}
+}
+
+void RACMetricsRecordEvent(NSUInteger slot, RACMetricsEvent event, uint64_t duration) {
+	if (slot == 0) return;
+
+	RACMetricsCounters *counters = RACMetricsStorageCounters(RACMetricsCurrentStorage(), slot);
+	switch (event) {
+		case RACMetricsEventNext:
+			counters->nextCount++;
+			break;
+
+		case RACMetricsEventError:
+			counters->errorCount++;
+			break;
+
+		case RACMetricsEventCompleted:
+			counters->completedCount++;
+			break;
+
+		case RACMetricsEventScheduled:
+			break;
+	}
+
+	counters->callbackCount++;
+	counters->totalDuration += duration;
+	if (duration > counters->maximumDuration) counters->maximumDuration = duration;
+	counters->buckets[RACMetricsBucketIndex(duration)]++;
+}
+
+@interface RACMetricsEntry () {
+	// The histogram of callback durations, with RACMetricsBucketCount buckets.
+	uint64_t _buckets[RACMetricsBucketCount];
+
+	uint64_t _totalDuration;
+	uint64_t _maximumDuration;
+}
+
+- (instancetype)initWithName:(NSString *)name counters:(const RACMetricsCounters *)counters;
+
+@end
+
+@interface RACMetricsSnapshot ()
+
+- (instancetype)initWithSignals:(NSDictionary *)signals schedulers:(NSDictionary *)schedulers;
+
+@end
+
+@implementation RACMetrics
+
+#pragma mark Recording
+
++ (BOOL)isEnabled {
+	return RACMetricsEnabled();
+}
+
++ (void)setEnabled:(BOOL)enabled {
+	RACMetricsEnabledFlag = (enabled ? 1 : 0);
+	OSMemoryBarrier();
+}
+
++ (void)reset {
+	OSSpinLockLock(&RACMetricsLock);
+
+	OSAtomicIncrement64Barrier(&RACMetricsEpoch);
+	RACMetricsStorageClear(&RACMetricsRetired);
+
+	OSSpinLockUnlock(&RACMetricsLock);
+}
+
+#pragma mark Snapshots
+
++ (RACMetricsSnapshot *)snapshot {
+	NSArray *names;
+	NSArray *kinds;
+	RACMetricsCounters *totals;
+
+	OSSpinLockLock(&RACMetricsLock);
+	{
+		names = [RACMetricsSlotNames copy];
+		kinds = [RACMetricsSlotKinds copy];
+		totals = calloc(MAX(names.count, 1), sizeof(*totals));
+
+		void (^addCounters)(NSUInteger, RACMetricsCounters *) = ^(NSUInteger slot, RACMetricsCounters *counters) {
+			RACMetricsCountersAdd(&totals[slot], counters);
+		};
+
+		RACMetricsStorageEnumerate(&RACMetricsRetired, addCounters);
+
+		for (RACMetricsThreadStorage *storage = RACMetricsThreads; storage != NULL; storage = storage->next) {
+			if (storage->epoch != RACMetricsEpoch) continue;
+
+			RACMetricsStorageEnumerate(storage, addCounters);
+		}
+	}
+	OSSpinLockUnlock(&RACMetricsLock);
+
+	NSMutableDictionary *signals = [NSMutableDictionary dictionary];
+	NSMutableDictionary *schedulers = [NSMutableDictionary dictionary];
+
+	for (NSUInteger slot = 1; slot < names.count; slot++) {
+		RACMetricsCounters *counters = &totals[slot];
+		if (counters->subscriptionCount == 0 && counters->callbackCount == 0) continue;
+
+		RACMetricsEntry *entry = [[RACMetricsEntry alloc] initWithName:names[slot] counters:counters];
+		if ([kinds[slot] unsignedIntegerValue] == RACMetricsKindScheduler) {
+			schedulers[entry.name] = entry;
+		} else {
+			signals[entry.name] = entry;
+		}
+	}
+
+	free(totals);
+
+	return [[RACMetricsSnapshot alloc] initWithSignals:signals schedulers:schedulers];
+}
+
+@end
+
+@implementation RACMetricsEntry
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithName:(NSString *)name counters:(const RACMetricsCounters *)counters {
+	NSCParameterAssert(name != nil);
+	NSCParameterAssert(counters != NULL);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_name = [name copy];
+	_nextCount = counters->nextCount;
+	_errorCount = counters->errorCount;
+	_completedCount = counters->completedCount;
+	_subscriptionCount = counters->subscriptionCount;
+	_callbackCount = counters->callbackCount;
+	_totalDuration = counters->totalDuration;
+	_maximumDuration = counters->maximumDuration;
+
+	// +reset can race with disposal, which would leave the count negative.
+	_subscriberCount = (uint64_t)MAX(counters->subscriberCount, 0);
+
+	memcpy(_buckets, counters->buckets, sizeof(_buckets));
+
+	return self;
+}
+
+#pragma mark Durations
+
+- (NSTimeInterval)totalCallbackDuration {
+	return (NSTimeInterval)_totalDuration / NSEC_PER_SEC;
+}
+
+- (NSTimeInterval)maximumCallbackDuration {
+	return (NSTimeInterval)_maximumDuration / NSEC_PER_SEC;
+}
+
+- (NSTimeInterval)callbackDurationAtPercentile:(double)percentile {
+	NSCParameterAssert(percentile >= 0 && percentile <= 1);
+
+	if (self.callbackCount == 0) return 0;
+
+	uint64_t threshold = MAX((uint64_t)ceil(percentile * self.callbackCount), 1);
+	uint64_t seen = 0;
+
+	for (NSUInteger i = 0; i < RACMetricsBucketCount; i++) {
+		seen += _buckets[i];
+		if (seen >= threshold) {
+			return (NSTimeInterval)MIN(RACMetricsBucketUpperBound(i) - 1, _maximumDuration) / NSEC_PER_SEC;
+		}
+	}
+
+	return self.maximumCallbackDuration;
+}
+
+#pragma mark Serialization
+
+- (NSDictionary *)dictionaryRepresentation {
+	NSMutableArray *histogram = [NSMutableArray array];
+	for (NSUInteger i = 0; i < RACMetricsBucketCount; i++) {
+		if (_buckets[i] == 0) continue;
+
+		[histogram addObject:@{
+			@"upperBound": @((NSTimeInterval)RACMetricsBucketUpperBound(i) / NSEC_PER_SEC),
+			@"count": @(_buckets[i]),
+		}];
+	}
+
+	return @{
+		@"next": @(self.nextCount),
+		@"error": @(self.errorCount),
+		@"completed": @(self.completedCount),
+		@"subscribers": @(self.subscriberCount),
+		@"subscriptions": @(self.subscriptionCount),
+		@"callbacks": @(self.callbackCount),
+		@"callbackDuration": @{
+			@"total": @(self.totalCallbackDuration),
+			@"max": @(self.maximumCallbackDuration),
+			@"p50": @([self callbackDurationAtPercentile:0.5]),
+			@"p90": @([self callbackDurationAtPercentile:0.9]),
+			@"p99": @([self callbackDurationAtPercentile:0.99]),
+			@"histogram": histogram,
+		},
+	};
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@ next: %llu error: %llu completed: %llu subscribers: %llu", self.class, self, self.name, self.nextCount, self.errorCount, self.completedCount, self.subscriberCount];
+}
+
+@end
+
+@implementation RACMetricsSnapshot
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithSignals:(NSDictionary *)signals schedulers:(NSDictionary *)schedulers {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_signals = [signals copy];
+	_schedulers = [schedulers copy];
+
+	return self;
+}
+
+#pragma mark Serialization
+
+- (NSDictionary *)dictionaryRepresentation {
+	NSDictionary * (^representEntries)(NSDictionary *) = ^(NSDictionary *entries) {
+		NSMutableDictionary *representations = [NSMutableDictionary dictionaryWithCapacity:entries.count];
+		[entries enumerateKeysAndObjectsUsingBlock:^(NSString *name, RACMetricsEntry *entry, BOOL *stop) {
+			representations[name] = entry.dictionaryRepresentation;
+		}];
+
+		return representations;
+	};
+
+	return @{
+		@"signals": representEntries(self.signals),
+		@"schedulers": representEntries(self.schedulers),
+	};
+}
+
+- (NSData *)JSONData {
+	NSError *error = nil;
+	NSData *data = [NSJSONSerialization dataWithJSONObject:self.dictionaryRepresentation options:0 error:&error];
+	NSAssert(data != nil, @"Could not serialize metrics: %@", error);
+
+	return data;
+}
+
+@end
@@ -0,0 +1,19 @@
+//
+//  RACParallelScheduler+Private.h
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACParallelScheduler.h"
+
+@interface RACParallelScheduler ()
+
+// Whether the calling thread is one of the receiver's workers.
+//
+// Blocking a worker can keep the receiver from running the blocks which would
+// unblock it, so callers should avoid waiting when this is YES.
+@property (nonatomic, assign, readonly, getter = isCurrentThreadWorker) BOOL currentThreadWorker;
+
+@end
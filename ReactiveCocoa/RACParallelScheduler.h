@@ -0,0 +1,49 @@
+//
+//  RACParallelScheduler.h
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RACDisposable;
+
+/// Runs blocks concurrently on a fixed pool of worker threads, to spread
+/// CPU-bound work across cores.
+///
+/// Each worker has its own queue of blocks. Blocks scheduled from a worker go
+/// onto that worker's queue, and idle workers steal blocks from busy ones, so
+/// work stays balanced without contending on a single queue.
+///
+/// **This is not a RACScheduler**, since RACSchedulers must run their blocks
+/// serially. It can't be used with operators like -deliverOn:, and blocks run
+/// by it do not have a +[RACScheduler currentScheduler]. Use
+/// -[RACSignal parallelMap:onScheduler:ordered:] to run signal work on it.
+@interface RACParallelScheduler : NSObject
+
+/// The number of worker threads.
+@property (nonatomic, assign, readonly) NSUInteger workerCount;
+
+/// Initializes the receiver with one worker for each active processor.
+- (id)init;
+
+/// Initializes the receiver and starts its workers.
+///
+/// workerCount - The number of worker threads to start. This must be greater
+///               than zero.
+///
+/// Returns the initialized object.
+- (id)initWithWorkerCount:(NSUInteger)workerCount;
+
+/// Schedules the given block to run on one of the receiver's workers.
+///
+/// block - The block to run. It may run concurrently with any other block
+///         scheduled on the receiver. Cannot be NULL.
+///
+/// Returns a disposable which can be used to cancel the block before it begins
+/// executing.
+- (RACDisposable *)schedule:(void (^)(void))block;
+
+@end
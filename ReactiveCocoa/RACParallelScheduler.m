@@ -0,0 +1,366 @@
+//
+//  RACParallelScheduler.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACParallelScheduler+Private.h"
+#import "RACDisposable.h"
+#import <libkern/OSAtomic.h>
+#import <pthread.h>
+
+// The number of blocks each worker's deque can hold. Once a deque is full,
+// blocks go onto the shared queue instead.
+#define RACParallelSchedulerDequeCapacity 1024
+
+// A work-stealing deque of retained blocks.
+//
+// Only the owning worker pushes and pops at the bottom. Any worker can steal
+// from the top.
+typedef struct {
+	volatile int64_t top;
+	volatile int64_t bottom;
+	void * volatile blocks[RACParallelSchedulerDequeCapacity];
+} RACParallelSchedulerDeque;
+
+// Pushes a retained block onto the bottom of the deque.
+//
+// This must only be invoked by the owning worker.
+//
+// Returns whether there was room for the block.
+static BOOL RACParallelSchedulerDequePush(RACParallelSchedulerDeque *deque, void *block) {
+	int64_t bottom = deque->bottom;
+	int64_t top = deque->top;
+	if (bottom - top >= RACParallelSchedulerDequeCapacity) return NO;
+
+	deque->blocks[bottom % RACParallelSchedulerDequeCapacity] = block;
+
+	// Publish the block before making it visible to thieves.
+	OSMemoryBarrier();
+	deque->bottom = bottom + 1;
+
+	return YES;
+}
+
+// Pops the most recently pushed block from the bottom of the deque.
+//
+// This must only be invoked by the owning worker.
+//
+// Returns a retained block, or NULL if the deque was empty.
+static void *RACParallelSchedulerDequePop(RACParallelSchedulerDeque *deque) {
+	int64_t bottom = deque->bottom - 1;
+	deque->bottom = bottom;
+	OSMemoryBarrier();
+
+	int64_t top = deque->top;
+	if (top > bottom) {
+		deque->bottom = bottom + 1;
+		return NULL;
+	}
+
+	void *block = deque->blocks[bottom % RACParallelSchedulerDequeCapacity];
+	if (top == bottom) {
+		// This is the last block, so race any thieves for it.
+		if (!OSAtomicCompareAndSwap64Barrier(top, top + 1, &deque->top)) block = NULL;
+		deque->bottom = bottom + 1;
+	}
+
+	return block;
+}
+
+// Steals the least recently pushed block from the top of the deque.
+//
+// This may be invoked from any worker.
+//
+// Returns a retained block, or NULL if the deque was empty or another worker
+// took the block first.
+static void *RACParallelSchedulerDequeSteal(RACParallelSchedulerDeque *deque) {
+	int64_t top = deque->top;
+	OSMemoryBarrier();
+	int64_t bottom = deque->bottom;
+	if (top >= bottom) return NULL;
+
+	void *block = deque->blocks[top % RACParallelSchedulerDequeCapacity];
+	if (!OSAtomicCompareAndSwap64Barrier(top, top + 1, &deque->top)) return NULL;
+
+	return block;
+}
+
+@class RACParallelSchedulerWorkers;
+
+// Identifies the worker running on the current thread.
+typedef struct {
+	__unsafe_unretained RACParallelSchedulerWorkers *workers;
+	NSUInteger index;
+} RACParallelSchedulerWorkerContext;
+
+// Returns the thread-specific key which holds the current thread's
+// RACParallelSchedulerWorkerContext, if it's a worker.
+static pthread_key_t RACParallelSchedulerWorkerKey(void) {
+	static pthread_key_t key;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		pthread_key_create(&key, NULL);
+	});
+
+	return key;
+}
+
+// Owns the queues and threads of a RACParallelScheduler.
+//
+// This is separate from the scheduler so that the workers can outlive it long
+// enough to finish their blocks and exit.
+@interface RACParallelSchedulerWorkers : NSObject {
+	NSUInteger _workerCount;
+
+	// One deque for each worker.
+	RACParallelSchedulerDeque *_deques;
+
+	// Blocks scheduled from outside of the workers, or which didn't fit in
+	// a worker's deque. This should only be used while `_sharedBlocksLock` is
+	// held.
+	NSMutableArray *_sharedBlocks;
+	OSSpinLock _sharedBlocksLock;
+
+	// The number of blocks in `_sharedBlocks`, which can be read without the
+	// lock.
+	volatile int32_t _sharedBlockCount;
+
+	// The number of workers which are waiting (or about to wait) on
+	// `_semaphore`.
+	volatile int32_t _idleCount;
+	dispatch_semaphore_t _semaphore;
+
+	volatile int32_t _stopped;
+}
+
+- (id)initWithWorkerCount:(NSUInteger)workerCount;
+
+// Enqueues a block, and wakes up an idle worker if there is one.
+- (void)enqueueBlock:(void (^)(void))block;
+
+// Tells the workers to exit once they run out of blocks.
+- (void)stop;
+
+// Whether the calling thread is one of the receiver's workers.
+- (BOOL)isCurrentThreadWorker;
+
+@end
+
+@interface RACParallelScheduler ()
+
+@property (nonatomic, strong, readonly) RACParallelSchedulerWorkers *workers;
+
+@end
+
+@implementation RACParallelScheduler
+
+#pragma mark Lifecycle
+
+- (id)init {
+	return [self initWithWorkerCount:NSProcessInfo.processInfo.activeProcessorCount];
+}
+
+- (id)initWithWorkerCount:(NSUInteger)workerCount {
+	NSCParameterAssert(workerCount > 0);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_workerCount = workerCount;
+	_workers = [[RACParallelSchedulerWorkers alloc] initWithWorkerCount:workerCount];
+
+	return self;
+}
+
+- (void)dealloc {
+	[_workers stop];
+}
+
+#pragma mark Scheduling
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	NSCParameterAssert(block != NULL);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+
+	[self.workers enqueueBlock:^{
+		if (disposable.disposed) return;
+		block();
+	}];
+
+	return disposable;
+}
+
+- (BOOL)isCurrentThreadWorker {
+	return [self.workers isCurrentThreadWorker];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> workers: %lu", self.class, self, (unsigned long)self.workerCount];
+}
+
+@end
+
+@implementation RACParallelSchedulerWorkers
+
+#pragma mark Lifecycle
+
+- (id)initWithWorkerCount:(NSUInteger)workerCount {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_workerCount = workerCount;
+	_deques = calloc(workerCount, sizeof(*_deques));
+	_sharedBlocks = [[NSMutableArray alloc] init];
+	_sharedBlocksLock = OS_SPINLOCK_INIT;
+	_semaphore = dispatch_semaphore_create(0);
+
+	for (NSUInteger i = 0; i < workerCount; i++) {
+		NSThread *thread = [[NSThread alloc] initWithTarget:self selector:@selector(runWorker:) object:@(i)];
+		thread.name = [NSString stringWithFormat:@"com.ReactiveCocoa.RACParallelScheduler.worker-%lu", (unsigned long)i];
+		[thread start];
+	}
+
+	return self;
+}
+
+- (void)dealloc {
+	// Every worker has exited by now, and they don't exit while any blocks
+	// remain, so the deques are empty.
+	free(_deques);
+
+#if !OS_OBJECT_HAVE_OBJC_SUPPORT
+	dispatch_release(_semaphore);
+#endif
+}
+
+- (void)stop {
+	OSAtomicOr32Barrier(1, (volatile uint32_t *)&_stopped);
+
+	for (NSUInteger i = 0; i < _workerCount; i++) {
+		dispatch_semaphore_signal(_semaphore);
+	}
+}
+
+#pragma mark Queues
+
+- (BOOL)isCurrentThreadWorker {
+	RACParallelSchedulerWorkerContext *context = pthread_getspecific(RACParallelSchedulerWorkerKey());
+	return context != NULL && context->workers == self;
+}
+
+- (void)enqueueBlock:(void (^)(void))block {
+	void *retainedBlock = (void *)CFBridgingRetain([block copy]);
+
+	RACParallelSchedulerWorkerContext *context = pthread_getspecific(RACParallelSchedulerWorkerKey());
+	BOOL pushed = NO;
+
+	// Blocks scheduled by a worker stay local to it, unless stolen.
+	if (context != NULL && context->workers == self) {
+		pushed = RACParallelSchedulerDequePush(&_deques[context->index], retainedBlock);
+	}
+
+	if (!pushed) {
+		OSSpinLockLock(&_sharedBlocksLock);
+		[_sharedBlocks addObject:CFBridgingRelease(retainedBlock)];
+		OSSpinLockUnlock(&_sharedBlocksLock);
+
+		OSAtomicIncrement32Barrier(&_sharedBlockCount);
+	} else {
+		OSMemoryBarrier();
+	}
+
+	if (_idleCount > 0) dispatch_semaphore_signal(_semaphore);
+}
+
+// Returns a retained block for the given worker to run, or NULL if there's no
+// work anywhere.
+- (void *)dequeueBlockForWorker:(NSUInteger)index {
+	void *block = RACParallelSchedulerDequePop(&_deques[index]);
+	if (block != NULL) return block;
+
+	if (_sharedBlockCount > 0) {
+		OSSpinLockLock(&_sharedBlocksLock);
+
+		if (_sharedBlocks.count > 0) {
+			block = (void *)CFBridgingRetain(_sharedBlocks[0]);
+			[_sharedBlocks removeObjectAtIndex:0];
+		}
+
+		OSSpinLockUnlock(&_sharedBlocksLock);
+
+		if (block != NULL) {
+			OSAtomicDecrement32Barrier(&_sharedBlockCount);
+			return block;
+		}
+	}
+
+	for (NSUInteger i = 1; i < _workerCount; i++) {
+		block = RACParallelSchedulerDequeSteal(&_deques[(index + i) % _workerCount]);
+		if (block != NULL) return block;
+	}
+
+	return NULL;
+}
+
+// Whether any blocks are waiting to run.
+//
+// Since this doesn't take any locks, the result may be stale by the time it's
+// returned.
+- (BOOL)hasBlocks {
+	if (_sharedBlockCount > 0) return YES;
+
+	for (NSUInteger i = 0; i < _workerCount; i++) {
+		if (_deques[i].bottom > _deques[i].top) return YES;
+	}
+
+	return NO;
+}
+
+#pragma mark Workers
+
+- (void)runWorker:(NSNumber *)index {
+	RACParallelSchedulerWorkerContext context = {
+		.workers = self,
+		.index = index.unsignedIntegerValue,
+	};
+
+	pthread_setspecific(RACParallelSchedulerWorkerKey(), &context);
+
+	while (YES) {
+		void *retainedBlock = [self dequeueBlockForWorker:context.index];
+
+		if (retainedBlock != NULL) {
+			@autoreleasepool {
+				void (^block)(void) = CFBridgingRelease(retainedBlock);
+				block();
+			}
+
+			continue;
+		}
+
+		// Announce that we're going idle, then check for work again, in case
+		// something was enqueued before the announcement was visible.
+		OSAtomicIncrement32Barrier(&_idleCount);
+
+		if (![self hasBlocks]) {
+			if (_stopped) {
+				OSAtomicDecrement32Barrier(&_idleCount);
+				break;
+			}
+
+			dispatch_semaphore_wait(_semaphore, DISPATCH_TIME_FOREVER);
+		}
+
+		OSAtomicDecrement32Barrier(&_idleCount);
+	}
+
+	pthread_setspecific(RACParallelSchedulerWorkerKey(), NULL);
+}
+
+@end
@@ -8,8 +8,33 @@
 
 #import "RACPassthroughSubscriber.h"
 #import "RACCompoundDisposable.h"
+#import "RACDemand.h"
+#import "RACMetrics+Private.h"
 #import "RACSignal.h"
 #import "RACSignalProvider.h"
+#import <libkern/OSAtomic.h>
+#import <objc/runtime.h>
+
+// The event types reported by the `event` probe.
+//
+// These are part of the probe's interface, so existing values must not change.
+typedef enum : int {
+	RACSignalTraceEventNext = 0,
+	RACSignalTraceEventError = 1,
+	RACSignalTraceEventCompleted = 2,
+} RACSignalTraceEvent;
+
+// Used to associate a trace ID with each signal.
+static void *RACSignalTraceIDKey = &RACSignalTraceIDKey;
+
+// Protects the trace IDs associated with signals.
+static OSSpinLock RACSignalTraceIDLock = OS_SPINLOCK_INIT;
+
+// Returns a new process-unique ID for the tracing probes. This will never be 0.
+static uint64_t RACNextTraceID(void) {
+	static volatile int64_t lastID = 0;
+	return (uint64_t)OSAtomicIncrement64Barrier(&lastID);
+}
 
 static const char *cleanedDTraceString(NSString *original) {
 	return [original stringByReplacingOccurrencesOfString:@"\\s+" withString:@" " options:NSRegularExpressionSearch range:NSMakeRange(0, original.length)].UTF8String;
@@ -26,7 +51,48 @@ static const char *cleanedSignalDescription(RACSignal *signal) {
 	return cleanedDTraceString(desc);
 }
 
-@interface RACPassthroughSubscriber ()
+// Returns the trace ID of the given signal, assigning one the first time.
+//
+// When an ID is assigned, the `named` probe fires to describe the signal.
+static uint64_t RACTraceIDForSignal(RACSignal *signal) {
+	if (signal == nil) return 0;
+
+	BOOL assigned = NO;
+
+	OSSpinLockLock(&RACSignalTraceIDLock);
+
+	NSNumber *traceID = objc_getAssociatedObject(signal, RACSignalTraceIDKey);
+	if (traceID == nil) {
+		traceID = @(RACNextTraceID());
+		objc_setAssociatedObject(signal, RACSignalTraceIDKey, traceID, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+		assigned = YES;
+	}
+
+	OSSpinLockUnlock(&RACSignalTraceIDLock);
+
+	if (assigned && RACSIGNAL_NAMED_ENABLED()) {
+		RACSIGNAL_NAMED(traceID.unsignedLongLongValue, cleanedSignalDescription(signal));
+	}
+
+	return traceID.unsignedLongLongValue;
+}
+
+@interface RACPassthroughSubscriber () {
+	// The trace ID of `signal`, or 0 if one hasn't been looked up yet.
+	//
+	// Every lookup returns the same ID, so this can simply be overwritten.
+	volatile int64_t _signalTraceID;
+
+	// The trace ID of this subscription, or 0 if one hasn't been assigned yet.
+	//
+	// Events may be sent from several threads at once, so this must only be
+	// assigned with a compare-and-swap.
+	volatile int64_t _traceID;
+
+	// The slot to record metrics into, or 0 if metrics were disabled when the
+	// subscription was made.
+	NSUInteger _metricsSlot;
+}
 
 // The subscriber to which events should be forwarded.
 @property (nonatomic, strong, readonly) id<RACSubscriber> innerSubscriber;
@@ -58,40 +124,113 @@ static const char *cleanedSignalDescription(RACSignal *signal) {
 	_signal = signal;
 	_disposable = disposable;
 
+	// Look up the signal's ID while it's definitely still alive.
+	if (RACSIGNAL_EVENT_ENABLED()) _signalTraceID = (int64_t)RACTraceIDForSignal(signal);
+
+	if (RACMetricsEnabled()) [self startRecordingMetrics];
+
 	[self.innerSubscriber didSubscribeWithDisposable:self.disposable];
 	return self;
 }
 
+#pragma mark Metrics
+
+// Records this subscription, and sets up `_metricsSlot` so that events will be
+// recorded as well.
+- (void)startRecordingMetrics {
+	if (self.signal == nil) return;
+
+	// Names are only set by default when RAC_DEBUG_SIGNAL_NAMES is, so fall back
+	// to the class name to keep unnamed signals from being recorded separately.
+	NSString *name = self.signal.name;
+	if (name.length == 0) name = NSStringFromClass(self.signal.class);
+
+	NSUInteger slot = RACMetricsSlotForName(RACMetricsKindSignal, name);
+	if (slot == 0) return;
+
+	_metricsSlot = slot;
+	RACMetricsRecordSubscription(slot, YES);
+
+	[self.disposable addDisposable:[RACDisposable disposableWithBlock:^{
+		RACMetricsRecordSubscription(slot, NO);
+	}]];
+}
+
+#pragma mark Tracing
+
+// Fires the `event` probe, assigning trace IDs as necessary.
+//
+// This should only be invoked if RACSIGNAL_EVENT_ENABLED() is true.
+- (void)traceEvent:(RACSignalTraceEvent)event {
+	if (_signalTraceID == 0) _signalTraceID = (int64_t)RACTraceIDForSignal(self.signal);
+
+	if (_traceID == 0) {
+		int64_t traceID = (int64_t)RACNextTraceID();
+
+		// Only the thread which publishes its ID describes the subscription,
+		// so every event is traced under the same ID.
+		if (OSAtomicCompareAndSwap64Barrier(0, traceID, &_traceID) && RACSIGNAL_NAMED_ENABLED()) {
+			RACSIGNAL_NAMED((uint64_t)traceID, cleanedDTraceString(self.innerSubscriber.description));
+		}
+	}
+
+	RACSIGNAL_EVENT((uint64_t)_signalTraceID, (uint64_t)_traceID, event, RACMetricsTimestamp());
+}
+
 #pragma mark RACSubscriber
 
 - (void)sendNext:(id)value {
 	if (self.disposable.disposed) return;
 
+	if (RACSIGNAL_EVENT_ENABLED()) [self traceEvent:RACSignalTraceEventNext];
+
 	if (RACSIGNAL_NEXT_ENABLED()) {
 		RACSIGNAL_NEXT(cleanedSignalDescription(self.signal), cleanedDTraceString(self.innerSubscriber.description), cleanedDTraceString([value description]));
 	}
 
-	[self.innerSubscriber sendNext:value];
+	if (_metricsSlot != 0 && RACMetricsEnabled()) {
+		uint64_t startTime = RACMetricsTimestamp();
+		[self.innerSubscriber sendNext:value];
+		RACMetricsRecordEvent(_metricsSlot, RACMetricsEventNext, RACMetricsTimestamp() - startTime);
+	} else {
+		[self.innerSubscriber sendNext:value];
+	}
 }
 
 - (void)sendError:(NSError *)error {
 	if (self.disposable.disposed) return;
 
+	if (RACSIGNAL_EVENT_ENABLED()) [self traceEvent:RACSignalTraceEventError];
+
 	if (RACSIGNAL_ERROR_ENABLED()) {
 		RACSIGNAL_ERROR(cleanedSignalDescription(self.signal), cleanedDTraceString(self.innerSubscriber.description), cleanedDTraceString(error.description));
 	}
 
-	[self.innerSubscriber sendError:error];
+	if (_metricsSlot != 0 && RACMetricsEnabled()) {
+		uint64_t startTime = RACMetricsTimestamp();
+		[self.innerSubscriber sendError:error];
+		RACMetricsRecordEvent(_metricsSlot, RACMetricsEventError, RACMetricsTimestamp() - startTime);
+	} else {
+		[self.innerSubscriber sendError:error];
+	}
 }
 
 - (void)sendCompleted {
 	if (self.disposable.disposed) return;
 
+	if (RACSIGNAL_EVENT_ENABLED()) [self traceEvent:RACSignalTraceEventCompleted];
+
 	if (RACSIGNAL_COMPLETED_ENABLED()) {
 		RACSIGNAL_COMPLETED(cleanedSignalDescription(self.signal), cleanedDTraceString(self.innerSubscriber.description));
 	}
 
-	[self.innerSubscriber sendCompleted];
+	if (_metricsSlot != 0 && RACMetricsEnabled()) {
+		uint64_t startTime = RACMetricsTimestamp();
+		[self.innerSubscriber sendCompleted];
+		RACMetricsRecordEvent(_metricsSlot, RACMetricsEventCompleted, RACMetricsTimestamp() - startTime);
+	} else {
+		[self.innerSubscriber sendCompleted];
+	}
 }
 
 - (void)didSubscribeWithDisposable:(RACCompoundDisposable *)disposable {
@@ -100,4 +239,8 @@ static const char *cleanedSignalDescription(RACSignal *signal) {
 	}
 }
 
+- (RACDemand *)demand {
+	return [RACDemand demandForSubscriber:self.innerSubscriber];
+}
+
 @end
@@ -37,4 +37,10 @@
 /// date - The date to convert. This must not be nil.
 + (dispatch_time_t)wallTimeWithDate:(NSDate *)date;
 
+/// Converts a delay from now into a GCD time using dispatch_time().
+///
+/// delay - The number of nanoseconds from now. Delays which are too large for
+///         GCD to represent are treated as never.
++ (dispatch_time_t)timeWithNanoseconds:(uint64_t)delay;
+
 @end
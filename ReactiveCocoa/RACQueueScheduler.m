@@ -57,6 +57,12 @@
 	return dispatch_walltime(&walltime, 0);
 }
 
++ (dispatch_time_t)timeWithNanoseconds:(uint64_t)delay {
+	if (delay > INT64_MAX) return DISPATCH_TIME_FOREVER;
+
+	return dispatch_time(DISPATCH_TIME_NOW, (int64_t)delay);
+}
+
 #pragma mark RACScheduler
 
 - (RACDisposable *)schedule:(void (^)(void))block {
@@ -76,9 +82,19 @@
 	NSCParameterAssert(date != nil);
 	NSCParameterAssert(block != NULL);
 
+	return [self afterTime:[self.class wallTimeWithDate:date] schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[self.class timeWithNanoseconds:delay] schedule:block];
+}
+
+- (RACDisposable *)afterTime:(dispatch_time_t)when schedule:(void (^)(void))block {
 	RACDisposable *disposable = [[RACDisposable alloc] init];
 
-	dispatch_after([self.class wallTimeWithDate:date], self.queue, ^{
+	dispatch_after(when, self.queue, ^{
 		if (disposable.disposed) return;
 		[self performAsCurrentScheduler:block];
 	});
@@ -95,8 +111,19 @@
 	uint64_t intervalInNanoSecs = (uint64_t)(interval * NSEC_PER_SEC);
 	uint64_t leewayInNanoSecs = (uint64_t)(leeway * NSEC_PER_SEC);
 
+	return [self afterTime:[self.class wallTimeWithDate:date] repeatingEvery:intervalInNanoSecs withLeeway:leewayInNanoSecs schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(interval > 0);
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[self.class timeWithNanoseconds:delay] repeatingEvery:interval withLeeway:leeway schedule:block];
+}
+
+- (RACDisposable *)afterTime:(dispatch_time_t)when repeatingEvery:(uint64_t)interval withLeeway:(uint64_t)leeway schedule:(void (^)(void))block {
 	dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.queue);
-	dispatch_source_set_timer(timer, [self.class wallTimeWithDate:date], intervalInNanoSecs, leewayInNanoSecs);
+	dispatch_source_set_timer(timer, when, interval, leeway);
 	dispatch_source_set_event_handler(timer, block);
 	dispatch_resume(timer);
 
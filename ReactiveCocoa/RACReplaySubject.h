@@ -13,6 +13,11 @@ extern const NSUInteger RACReplaySubjectUnlimitedCapacity;
 /// A replay subject saves the values it is sent (up to its defined capacity)
 /// and resends those to new subscribers. It will also replay an error or
 /// completion.
+///
+/// Values are replayed to a new subscriber without blocking other threads from
+/// sending to the subject. Values sent during the replay are delivered to the
+/// new subscriber afterward, in order, even if the subject has a bounded
+/// capacity and they've already been trimmed.
 @interface RACReplaySubject : RACSubject
 
 /// Creates a new replay subject with the given capacity. A capacity of
@@ -15,16 +15,95 @@
 
 const NSUInteger RACReplaySubjectUnlimitedCapacity = NSUIntegerMax;
 
-@interface RACReplaySubject ()
+// The number of slots initially allocated for a bounded replay subject's
+// circular buffer. The buffer grows up to the subject's capacity as needed.
+static const NSUInteger RACReplaySubjectInitialBufferCapacity = 16;
+
+// The number of times a new subscriber will replay values outside of the
+// subject's lock before giving up on catching up with a busy producer. The
+// final pass is always performed while synchronized, which guarantees that
+// subscription finishes.
+static const NSUInteger RACReplaySubjectMaximumUnsynchronizedReplays = 4;
+
+@interface RACReplaySubject () {
+	// A circular buffer of the most recent values received, used instead of
+	// `valuesReceived` when the receiver has a bounded capacity. Each slot
+	// holds a retained value (with nil represented by RACTupleNil).
+	//
+	// Until `capacity` values have been received, the buffer is not wrapped and
+	// `_bufferStart` is zero, so it can be grown in place.
+	//
+	// These ivars should only be accessed while synchronized on self.
+	const void **_buffer;
+	NSUInteger _bufferAllocated;
+	NSUInteger _bufferStart;
+	NSUInteger _bufferCount;
+
+	// The total number of values ever received, which is also the sequence
+	// number of the most recent value.
+	//
+	// This ivar should only be accessed while synchronized on self.
+	NSUInteger _receivedCount;
+
+	// The number of subscribers currently replaying outside of the lock.
+	//
+	// This ivar should only be accessed while synchronized on self.
+	NSUInteger _replayCount;
+
+	// Values trimmed from `_buffer` while `_replayCount` was non-zero, oldest
+	// first, with nil represented by RACTupleNil. These immediately precede
+	// the values in `_buffer`, and are kept so that a replaying subscriber
+	// doesn't skip any values that arrive before it catches up.
+	//
+	// This ivar should only be accessed while synchronized on self.
+	NSMutableArray *_trimmedValues;
+}
 
 @property (nonatomic, assign, readonly) NSUInteger capacity;
 
 // These properties should only be modified while synchronized on self.
+//
+// `valuesReceived` is only used when the receiver has an unlimited capacity.
 @property (nonatomic, strong, readonly) NSMutableArray *valuesReceived;
 @property (nonatomic, assign) BOOL hasCompleted;
 @property (nonatomic, assign) BOOL hasError;
 @property (nonatomic, strong) NSError *error;
 
+// Records a received value, trimming the oldest value if the receiver is
+// over capacity.
+//
+// This method should only be invoked while synchronized on self.
+- (void)recordValue:(id)value;
+
+// Returns the sequence number preceding the oldest value which would be
+// replayed to a new subscriber.
+//
+// This method should only be invoked while synchronized on self.
+- (NSUInteger)oldestReplayedSequenceNumber;
+
+// Returns the recorded values which arrived after the value with the given
+// sequence number, oldest first, with nil represented by RACTupleNil.
+//
+// Values trimmed due to the receiver's capacity are only returned if a replay
+// was in progress when they were trimmed.
+//
+// sequenceNumber - The number of values received at the time of a previous
+//                  call, or the result of -oldestReplayedSequenceNumber.
+//
+// This method should only be invoked while synchronized on self.
+- (NSArray *)recordedValuesAfter:(NSUInteger)sequenceNumber;
+
+// Marks the start of a replay outside of the lock. Until a matching call to
+// -endReplay, values trimmed from the buffer are kept instead of released.
+//
+// This method should only be invoked while synchronized on self.
+- (void)beginReplay;
+
+// Marks the end of a replay started with -beginReplay.
+//
+// This method should only be invoked while synchronized on self.
+- (void)endReplay;
+
 @end
 
 
@@ -45,33 +124,174 @@ const NSUInteger RACReplaySubjectUnlimitedCapacity = NSUIntegerMax;
 	if (self == nil) return nil;
 	
 	_capacity = capacity;
-	_valuesReceived = (capacity == RACReplaySubjectUnlimitedCapacity ? [NSMutableArray array] : [NSMutableArray arrayWithCapacity:capacity]);
+	if (capacity == RACReplaySubjectUnlimitedCapacity) _valuesReceived = [NSMutableArray array];
 	
 	return self;
 }
 
+- (void)dealloc {
+	if (_buffer == NULL) return;
+
+	for (NSUInteger i = 0; i < _bufferCount; i++) {
+		CFRelease(_buffer[(_bufferStart + i) % _bufferAllocated]);
+	}
+
+	free(_buffer);
+	_buffer = NULL;
+}
+
+#pragma mark Value Storage
+
+- (void)recordValue:(id)value {
+	value = value ?: RACTupleNil.tupleNil;
+	_receivedCount++;
+
+	if (self.valuesReceived != nil) {
+		[self.valuesReceived addObject:value];
+		return;
+	}
+
+	if (self.capacity == 0) return;
+
+	if (_bufferCount < self.capacity) {
+		if (_bufferCount == _bufferAllocated) {
+			NSUInteger allocated = MIN(MAX(_bufferAllocated * 2, RACReplaySubjectInitialBufferCapacity), self.capacity);
+			const void **buffer = realloc(_buffer, allocated * sizeof(*buffer));
+			if (buffer == NULL) {
+				// This is checked even in release builds, since carrying on
+				// would dereference NULL.
+				NSLog(@"Could not grow replay buffer of %@ to %lu values", self, (unsigned long)allocated);
+				abort();
+			}
+
+			_buffer = buffer;
+			_bufferAllocated = allocated;
+		}
+
+		_buffer[_bufferCount++] = CFBridgingRetain(value);
+		return;
+	}
+
+	// The buffer is full, so overwrite the oldest value.
+	const void *oldestValue = _buffer[_bufferStart];
+	_buffer[_bufferStart] = CFBridgingRetain(value);
+	_bufferStart = (_bufferStart + 1) % _bufferAllocated;
+
+	if (_replayCount > 0) {
+		if (_trimmedValues == nil) _trimmedValues = [NSMutableArray array];
+		[_trimmedValues addObject:CFBridgingRelease(oldestValue)];
+	} else {
+		CFRelease(oldestValue);
+	}
+}
+
+- (NSUInteger)oldestReplayedSequenceNumber {
+	if (self.valuesReceived != nil) return 0;
+
+	return _receivedCount - _bufferCount;
+}
+
+- (NSArray *)recordedValuesAfter:(NSUInteger)sequenceNumber {
+	NSCParameterAssert(sequenceNumber <= _receivedCount);
+
+	if (self.valuesReceived != nil) {
+		return [self.valuesReceived subarrayWithRange:NSMakeRange(sequenceNumber, _receivedCount - sequenceNumber)];
+	}
+
+	NSUInteger trimmedCount = _trimmedValues.count;
+	NSUInteger availableCount = trimmedCount + _bufferCount;
+	NSUInteger count = MIN(_receivedCount - sequenceNumber, availableCount);
+	NSMutableArray *values = [NSMutableArray arrayWithCapacity:count];
+
+	for (NSUInteger i = availableCount - count; i < availableCount; i++) {
+		if (i < trimmedCount) {
+			[values addObject:_trimmedValues[i]];
+		} else {
+			[values addObject:(__bridge id)_buffer[(_bufferStart + i - trimmedCount) % _bufferAllocated]];
+		}
+	}
+
+	return values;
+}
+
+- (void)beginReplay {
+	_replayCount++;
+}
+
+- (void)endReplay {
+	NSCAssert(_replayCount > 0, @"Unbalanced call to -endReplay on %@", self);
+
+	if (--_replayCount == 0) _trimmedValues = nil;
+}
+
 #pragma mark RACSignal
 
 - (RACDisposable *)subscribe:(id<RACSubscriber>)subscriber {
 	RACCompoundDisposable *compoundDisposable = [RACCompoundDisposable compoundDisposable];
 
 	RACDisposable *schedulingDisposable = [RACScheduler.subscriptionScheduler schedule:^{
-		@synchronized (self) {
-			for (id value in self.valuesReceived) {
-				if (compoundDisposable.disposed) return;
+		// The sequence number of the last value sent to `subscriber`.
+		NSUInteger replayedCount = 0;
 
-				[subscriber sendNext:(value == RACTupleNil.tupleNil ? nil : value)];
+		// Whether -beginReplay has been invoked for this subscriber.
+		BOOL replaying = NO;
+
+		// Replay values from a snapshot, without holding the lock, so that
+		// a slow subscriber doesn't block producers. Any values which arrive in
+		// the meantime are caught up on with another pass.
+		for (NSUInteger pass = 0; ; pass++) {
+			NSArray *values;
+
+			@synchronized (self) {
+				if (pass == 0) replayedCount = [self oldestReplayedSequenceNumber];
+				values = [self recordedValuesAfter:replayedCount];
+
+				// Once caught up (or out of patience), replay anything left and
+				// subscribe for live values without releasing the lock, so no
+				// value can be missed or delivered out of order.
+				if (values.count == 0 || pass >= RACReplaySubjectMaximumUnsynchronizedReplays) {
+					if (replaying) [self endReplay];
+
+					for (id value in values) {
+						if (compoundDisposable.disposed) return;
+
+						[subscriber sendNext:(value == RACTupleNil.tupleNil ? nil : value)];
+					}
+
+					if (compoundDisposable.disposed) return;
+
+					if (self.hasCompleted) {
+						[subscriber sendCompleted];
+					} else if (self.hasError) {
+						[subscriber sendError:self.error];
+					} else {
+						RACDisposable *subscriptionDisposable = [super subscribe:subscriber];
+						[compoundDisposable addDisposable:subscriptionDisposable];
+					}
+
+					return;
+				}
+
+				// Keep any values trimmed from here on, since they haven't been
+				// replayed yet.
+				if (!replaying) {
+					[self beginReplay];
+					replaying = YES;
+				}
+
+				replayedCount = _receivedCount;
 			}
 
-			if (compoundDisposable.disposed) return;
+			for (id value in values) {
+				if (compoundDisposable.disposed) {
+					@synchronized (self) {
+						[self endReplay];
+					}
+
+					return;
+				}
 
-			if (self.hasCompleted) {
-				[subscriber sendCompleted];
-			} else if (self.hasError) {
-				[subscriber sendError:self.error];
-			} else {
-				RACDisposable *subscriptionDisposable = [super subscribe:subscriber];
-				[compoundDisposable addDisposable:subscriptionDisposable];
+				[subscriber sendNext:(value == RACTupleNil.tupleNil ? nil : value)];
 			}
 		}
 	}];
@@ -85,12 +305,8 @@ const NSUInteger RACReplaySubjectUnlimitedCapacity = NSUIntegerMax;
 
 - (void)sendNext:(id)value {
 	@synchronized (self) {
-		[self.valuesReceived addObject:value ?: RACTupleNil.tupleNil];
+		[self recordValue:value];
 		[super sendNext:value];
-		
-		if (self.capacity != RACReplaySubjectUnlimitedCapacity && self.valuesReceived.count > self.capacity) {
-			[self.valuesReceived removeObjectsInRange:NSMakeRange(0, self.valuesReceived.count - self.capacity)];
-		}
 	}
 }
 
@@ -14,4 +14,7 @@
 
 + (RACSignal *)return:(id)value;
 
+// The value to send upon subscription.
+@property (nonatomic, strong, readonly) id value;
+
 @end
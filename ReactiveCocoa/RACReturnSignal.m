@@ -11,13 +11,6 @@
 #import "RACSubscriber.h"
 #import "RACUnit.h"
 
-@interface RACReturnSignal ()
-
-// The value to send upon subscription.
-@property (nonatomic, strong, readonly) id value;
-
-@end
-
 @implementation RACReturnSignal
 
 #pragma mark Properties
@@ -30,6 +23,14 @@
 #endif
 }
 
+- (instancetype)setNameWithBlock:(NSString * (^)(void))block {
+#ifdef DEBUG
+	return [super setNameWithBlock:block];
+#else
+	return self;
+#endif
+}
+
 - (NSString *)name {
 #ifdef DEBUG
 	return super.name;
@@ -8,8 +8,34 @@
 
 #import "RACScheduler.h"
 
-// The thread-specific current scheduler key.
-extern NSString * const RACSchedulerCurrentSchedulerKey;
+// Makes the given scheduler the current scheduler of the calling thread.
+//
+// The scheduler is not retained, so callers must keep it alive, and restore the
+// previous scheduler before returning. Calls must be strictly nested.
+//
+// scheduler - The scheduler which is about to run blocks on this thread, or nil
+//             to clear the current scheduler.
+//
+// Returns the previous current scheduler of the thread, which may be nil.
+extern RACScheduler *RACSchedulerExchangeCurrentScheduler(RACScheduler *scheduler);
+
+// Returns the current time on a monotonic clock, in nanoseconds.
+//
+// Unlike wall clock time, this isn't affected by changes to the system clock,
+// so it should be used for deadlines and intervals.
+extern uint64_t RACSchedulerMonotonicTime(void);
+
+// Converts a number of seconds into nanoseconds, for use with the scheduling
+// methods which accept nanoseconds.
+//
+// Negative intervals are treated as zero, and intervals which are too large
+// to represent are clamped.
+static inline uint64_t RACSchedulerNanosecondsWithTimeInterval(NSTimeInterval interval) {
+	if (!(interval > 0)) return 0;
+	if (interval >= (NSTimeInterval)INT64_MAX / NSEC_PER_SEC) return INT64_MAX;
+
+	return (uint64_t)(interval * NSEC_PER_SEC);
+}
 
 // A private interface for internal RAC use only.
 @interface RACScheduler ()
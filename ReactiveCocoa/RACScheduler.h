@@ -88,9 +88,29 @@ typedef void (^RACSchedulerRecursiveBlock)(void (^reschedule)(void));
 
 /// Schedule the given block for execution on the scheduler after the delay.
 ///
-/// Converts the delay into an NSDate, then invokes `-after:schedule:`.
+/// Converts the delay into nanoseconds, then invokes
+/// `-afterNanoseconds:schedule:`.
 - (RACDisposable *)afterDelay:(NSTimeInterval)delay schedule:(void (^)(void))block;
 
+/// Schedule the given block for execution on the scheduler after a number of
+/// nanoseconds have passed on a monotonic clock.
+///
+/// Unlike -after:schedule:, the delay is not affected by changes to the system
+/// clock, and doesn't need to be converted to and from a date.
+///
+/// The default implementation converts the delay into an NSDate, then invokes
+/// `-after:schedule:`. Subclasses should override it to avoid the conversion.
+///
+/// delay - The minimum number of nanoseconds to wait before `block` begins
+///         executing. The block may not execute immediately at this time,
+///         whether due to system load or another block on the scheduler
+///         currently being run.
+/// block - The block to schedule for execution. Cannot be nil.
+///
+/// Returns a disposable which can be used to cancel the scheduled block before
+/// it begins executing, or nil if cancellation is not supported.
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block;
+
 /// Reschedule the given block at a particular interval, starting at a specific
 /// time, and with a given leeway for deferral.
 ///
@@ -120,6 +140,32 @@ typedef void (^RACSchedulerRecursiveBlock)(void (^reschedule)(void));
 /// rescheduling, or nil if cancellation is not supported.
 - (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block;
 
+/// Reschedule the given block at a particular interval, starting after
+/// a number of nanoseconds have passed on a monotonic clock.
+///
+/// This behaves like -after:repeatingEvery:withLeeway:schedule:, except that
+/// all times are measured in nanoseconds on a monotonic clock, so they are not
+/// affected by changes to the system clock.
+///
+/// The default implementation converts its arguments into an NSDate and
+/// intervals, then invokes `-after:repeatingEvery:withLeeway:schedule:`.
+/// Subclasses should override it to avoid the conversion.
+///
+/// It is considered undefined behavior to invoke this method on the
+/// +immediateScheduler.
+///
+/// delay    - The minimum number of nanoseconds to wait before `block` first
+///            begins executing.
+/// interval - The number of nanoseconds between each execution of the block.
+///            This must be greater than zero.
+/// leeway   - A hint to the system indicating the number of nanoseconds that
+///            each scheduling can be deferred.
+/// block    - The block to repeatedly schedule for execution. Cannot be nil.
+///
+/// Returns a disposable which can be used to cancel the automatic scheduling and
+/// rescheduling, or nil if cancellation is not supported.
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block;
+
 /// Schedule the given recursive block for execution on the scheduler. The
 /// scheduler will automatically flatten any recursive scheduling into iteration
 /// instead, so this can be used without issue for blocks that may keep invoking
@@ -8,17 +8,102 @@
 
 #import "RACScheduler.h"
 #import "RACBacktrace.h"
-#import "RACCompoundDisposable.h"
 #import "RACDisposable.h"
 #import "RACImmediateScheduler.h"
+#import "RACMetrics+Private.h"
 #import "RACScheduler+Private.h"
+#import "RACSerialDisposable.h"
 #import "RACSubscriptionScheduler.h"
 #import "RACTargetQueueScheduler.h"
+#import <libkern/OSAtomic.h>
+#import <pthread.h>
 
-// The key for the thread-specific current scheduler.
-NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedulerKey";
+#if defined(__APPLE__)
+#import <mach/mach_time.h>
+#else
+#import <time.h>
+#endif
+
+// Returns the thread-specific key which holds the current scheduler, unretained.
+//
+// This is used instead of the thread dictionary, since it's read for every
+// scheduled block and many events.
+static pthread_key_t RACSchedulerCurrentSchedulerKey(void) {
+	static pthread_key_t key;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		pthread_key_create(&key, NULL);
+	});
+
+	return key;
+}
+
+RACScheduler *RACSchedulerExchangeCurrentScheduler(RACScheduler *scheduler) {
+	pthread_key_t key = RACSchedulerCurrentSchedulerKey();
+
+	RACScheduler *previousScheduler = (__bridge id)pthread_getspecific(key);
+	pthread_setspecific(key, (__bridge void *)scheduler);
+
+	return previousScheduler;
+}
+
+uint64_t RACSchedulerMonotonicTime(void) {
+#if defined(__APPLE__)
+	static mach_timebase_info_data_t timebase;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		mach_timebase_info(&timebase);
+	});
+
+	return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * NSEC_PER_SEC + (uint64_t)now.tv_nsec;
+#endif
+}
+
+// The state of a single -scheduleRecursiveBlock: call, which is shared by every
+// iteration of the recursive block.
+@interface RACSchedulerRecursion : NSObject {
+	// Guards the variables below.
+	OSSpinLock _lock;
+
+	// Whether an iteration of the recursive block is currently running.
+	BOOL _running;
+
+	// The number of times that the running iteration has rescheduled the
+	// recursive block.
+	NSUInteger _pendingCount;
+
+	// Whether -runIterations: is looping. If the scheduler runs blocks
+	// synchronously, iterations scheduled while this is set are added to
+	// `_handedOffCount` for the loop to run, instead of recursing.
+	BOOL _looping;
+	NSUInteger _handedOffCount;
+}
+
+@property (nonatomic, strong, readonly) RACScheduler *scheduler;
+@property (nonatomic, copy, readonly) RACSchedulerRecursiveBlock recursiveBlock;
+
+// Stops the recursion, and cancels the scheduled block which would run the
+// next iterations, if any.
+@property (nonatomic, strong, readonly) RACSerialDisposable *disposable;
+
+- (id)initWithScheduler:(RACScheduler *)scheduler recursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock;
+
+// Schedules a block which will run the given number of iterations of the
+// recursive block.
+- (void)scheduleIterations:(NSUInteger)count;
+
+@end
+
+@interface RACScheduler () {
+	// The slot to record metrics into, or 0 if one hasn't been looked up yet.
+	NSUInteger _metricsSlot;
+}
 
-@interface RACScheduler ()
 @property (nonatomic, readonly, copy) NSString *name;
 @end
 
@@ -90,11 +175,13 @@ NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedule
 }
 
 + (BOOL)isOnMainThread {
-	return [NSOperationQueue.currentQueue isEqual:NSOperationQueue.mainQueue] || [NSThread isMainThread];
+	// Check the thread first, since it's much cheaper than looking up the
+	// current queue.
+	return [NSThread isMainThread] || [NSOperationQueue.currentQueue isEqual:NSOperationQueue.mainQueue];
 }
 
 + (instancetype)currentScheduler {
-	RACScheduler *scheduler = NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey];
+	RACScheduler *scheduler = (__bridge id)pthread_getspecific(RACSchedulerCurrentSchedulerKey());
 	if (scheduler != nil) return scheduler;
 	if ([self.class isOnMainThread]) return RACScheduler.mainThreadScheduler;
 
@@ -114,7 +201,11 @@ NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedule
 }
 
 - (RACDisposable *)afterDelay:(NSTimeInterval)delay schedule:(void (^)(void))block {
-	return [self after:[NSDate dateWithTimeIntervalSinceNow:delay] schedule:block];
+	return [self afterNanoseconds:RACSchedulerNanosecondsWithTimeInterval(delay) schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	return [self after:[NSDate dateWithTimeIntervalSinceNow:(NSTimeInterval)delay / NSEC_PER_SEC] schedule:block];
 }
 
 - (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
@@ -122,70 +213,16 @@ NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedule
 	return nil;
 }
 
-- (RACDisposable *)scheduleRecursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock {
-	RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
-
-	[self scheduleRecursiveBlock:[recursiveBlock copy] addingToDisposable:disposable];
-	return disposable;
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSDate *date = [NSDate dateWithTimeIntervalSinceNow:(NSTimeInterval)delay / NSEC_PER_SEC];
+	return [self after:date repeatingEvery:(NSTimeInterval)interval / NSEC_PER_SEC withLeeway:(NSTimeInterval)leeway / NSEC_PER_SEC schedule:block];
 }
 
-- (void)scheduleRecursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock addingToDisposable:(RACCompoundDisposable *)disposable {
-	@autoreleasepool {
-		RACCompoundDisposable *selfDisposable = [RACCompoundDisposable compoundDisposable];
-		[disposable addDisposable:selfDisposable];
-
-		__weak RACDisposable *weakSelfDisposable = selfDisposable;
-
-		RACDisposable *schedulingDisposable = [self schedule:^{
-			@autoreleasepool {
-				// At this point, we've been invoked, so our disposable is now useless.
-				[disposable removeDisposable:weakSelfDisposable];
-			}
-
-			if (disposable.disposed) return;
-
-			void (^reallyReschedule)(void) = ^{
-				if (disposable.disposed) return;
-				[self scheduleRecursiveBlock:recursiveBlock addingToDisposable:disposable];
-			};
-
-			// Protects the variables below.
-			//
-			// This doesn't actually need to be __block qualified, but Clang
-			// complains otherwise. :C
-			__block NSLock *lock = [[NSLock alloc] init];
-			lock.name = [NSString stringWithFormat:@"%@ %s", self, sel_getName(_cmd)];
-
-			__block NSUInteger rescheduleCount = 0;
-
-			// Set to YES once synchronous execution has finished. Further
-			// rescheduling should occur immediately (rather than being
-			// flattened).
-			__block BOOL rescheduleImmediately = NO;
-
-			@autoreleasepool {
-				recursiveBlock(^{
-					[lock lock];
-					BOOL immediate = rescheduleImmediately;
-					if (!immediate) ++rescheduleCount;
-					[lock unlock];
-
-					if (immediate) reallyReschedule();
-				});
-			}
-
-			[lock lock];
-			NSUInteger synchronousCount = rescheduleCount;
-			rescheduleImmediately = YES;
-			[lock unlock];
-
-			for (NSUInteger i = 0; i < synchronousCount; i++) {
-				reallyReschedule();
-			}
-		}];
-
-		[selfDisposable addDisposable:schedulingDisposable];
-	}
+- (RACDisposable *)scheduleRecursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock {
+	RACSchedulerRecursion *recursion = [[RACSchedulerRecursion alloc] initWithScheduler:self recursiveBlock:recursiveBlock];
+	[recursion scheduleIterations:1];
+
+	return recursion.disposable;
 }
 
 - (void)performAsCurrentScheduler:(void (^)(void))block {
@@ -196,18 +233,23 @@ NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedule
 	// after our block is done executing, but only *after* all our concurrent
 	// invocations are done.
 
-	RACScheduler *previousScheduler = RACScheduler.currentScheduler;
-	NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey] = self;
+	RACScheduler *previousScheduler = RACSchedulerExchangeCurrentScheduler(self);
+
+	BOOL recordsMetrics = RACMetricsEnabled();
+	uint64_t startTime = 0;
+
+	if (recordsMetrics) {
+		if (_metricsSlot == 0) _metricsSlot = RACMetricsSlotForName(RACMetricsKindScheduler, self.name);
+		startTime = RACMetricsTimestamp();
+	}
 
 	@autoreleasepool {
 		block();
 	}
 
-	if (previousScheduler != nil) {
-		NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey] = previousScheduler;
-	} else {
-		[NSThread.currentThread.threadDictionary removeObjectForKey:RACSchedulerCurrentSchedulerKey];
-	}
+	if (recordsMetrics) RACMetricsRecordEvent(_metricsSlot, RACMetricsEventScheduled, RACMetricsTimestamp() - startTime);
+
+	RACSchedulerExchangeCurrentScheduler(previousScheduler);
 }
 
 @end
@@ -226,3 +268,103 @@ NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedule
 #pragma clang diagnostic pop
 
 @end
+
+@implementation RACSchedulerRecursion
+
+#pragma mark Lifecycle
+
+- (id)initWithScheduler:(RACScheduler *)scheduler recursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock {
+	NSCParameterAssert(scheduler != nil);
+	NSCParameterAssert(recursiveBlock != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_scheduler = scheduler;
+	_recursiveBlock = [recursiveBlock copy];
+	_disposable = [[RACSerialDisposable alloc] init];
+	_lock = OS_SPINLOCK_INIT;
+
+	return self;
+}
+
+#pragma mark Scheduling
+
+- (void)scheduleIterations:(NSUInteger)count {
+	if (self.disposable.disposed) return;
+
+	RACDisposable *schedulingDisposable = [self.scheduler schedule:^{
+		[self runIterations:count];
+	}];
+
+	// This may replace the disposable for a later block, if this one has
+	// already run. That's harmless, since every iteration checks for disposal
+	// before it starts.
+	if (schedulingDisposable != nil) self.disposable.disposable = schedulingDisposable;
+}
+
+- (void)runIterations:(NSUInteger)count {
+	OSSpinLockLock(&_lock);
+	BOOL handOff = _looping;
+	if (handOff) {
+		_handedOffCount += count;
+	} else {
+		_looping = YES;
+	}
+	OSSpinLockUnlock(&_lock);
+
+	if (handOff) return;
+
+	// Reschedules made while an iteration is running are counted, and
+	// scheduled together once the iteration returns. Any others need to
+	// schedule a new block.
+	void (^reschedule)(void) = ^{
+		OSSpinLockLock(&self->_lock);
+		BOOL flatten = self->_running;
+		if (flatten) self->_pendingCount++;
+		OSSpinLockUnlock(&self->_lock);
+
+		if (!flatten) [self scheduleIterations:1];
+	};
+
+	while (count > 0) {
+		if (self.disposable.disposed) {
+			OSSpinLockLock(&_lock);
+			_looping = NO;
+			_handedOffCount = 0;
+			OSSpinLockUnlock(&_lock);
+
+			return;
+		}
+
+		OSSpinLockLock(&_lock);
+		_running = YES;
+		_pendingCount = 0;
+		OSSpinLockUnlock(&_lock);
+
+		@autoreleasepool {
+			self.recursiveBlock(reschedule);
+		}
+
+		OSSpinLockLock(&_lock);
+		_running = NO;
+		NSUInteger remaining = count - 1 + _pendingCount;
+		OSSpinLockUnlock(&_lock);
+
+		// Yield to other blocks on the scheduler between iterations. If the
+		// scheduler is synchronous, the iterations are handed back to this
+		// loop.
+		if (remaining > 0) [self scheduleIterations:remaining];
+
+		OSSpinLockLock(&_lock);
+		count = _handedOffCount;
+		_handedOffCount = 0;
+
+		// Stop looping while still holding the lock, so that no iterations can
+		// be handed off after the count was read.
+		if (count == 0) _looping = NO;
+		OSSpinLockUnlock(&_lock);
+	}
+}
+
+@end
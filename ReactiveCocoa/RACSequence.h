@@ -39,6 +39,12 @@
 @property (nonatomic, copy, readonly) NSArray *array;
 
 /// Returns an enumerator of all objects in the sequence.
+///
+/// For sequences backed by an array or a string, the enumerator walks the
+/// underlying collection by index, without creating any `tail` sequences.
+///
+/// As with any NSEnumerator, the returned enumerator must not be used from more
+/// than one thread at a time.
 @property (nonatomic, copy, readonly) NSEnumerator *objectEnumerator;
 
 /// Converts a sequence into an eager sequence.
@@ -70,6 +76,24 @@
 /// they're evaluated.
 - (RACSignal *)signalWithScheduler:(RACScheduler *)scheduler;
 
+/// Evaluates the full sequence on the given scheduler, sending several values
+/// from each scheduled block.
+///
+/// Values are read with fast enumeration, rather than by following `tail`,
+/// which is much faster for large in-memory collections. Control of the
+/// scheduler is yielded after each batch, so other blocks on it aren't starved.
+///
+/// If the subscriber has opted into backpressure (see RACDemand), no more
+/// values are evaluated than it has requested.
+///
+/// scheduler - The scheduler on which to evaluate the sequence. Cannot be nil.
+/// batchSize - The maximum number of values to send from each scheduled block.
+///             This must be greater than zero.
+///
+/// Returns a signal which sends the receiver's values on the given scheduler as
+/// they're evaluated.
+- (RACSignal *)signalWithScheduler:(RACScheduler *)scheduler batchSize:(NSUInteger)batchSize;
+
 /// Applies a left fold to the sequence.
 ///
 /// This is the same as iterating the sequence along with a provided start value.
@@ -125,6 +149,47 @@
 /// Returns an object that passes the block or nil if no objects passed.
 - (id)objectPassingTest:(BOOL (^)(id value))block;
 
+/// Maps `block` across the values in the sequence, using every available core.
+///
+/// The sequence is evaluated eagerly, then split into chunks which are mapped
+/// concurrently.
+///
+/// block - The block to apply to each value. It may be invoked concurrently
+///         from many threads. If it returns nil, the value is skipped, as with
+///         -map:. Cannot be nil.
+///
+/// Returns an eager sequence of the mapped values, in the same order as the
+/// receiver.
+- (RACSequence *)parallelMap:(id (^)(id value))block;
+
+/// Filters the values in the sequence, using every available core.
+///
+/// The sequence is evaluated eagerly, then split into chunks which are tested
+/// concurrently.
+///
+/// block - The predicate to test each value with. It may be invoked
+///         concurrently from many threads. Cannot be nil.
+///
+/// Returns an eager sequence of the values which passed, in the same order as
+/// the receiver.
+- (RACSequence *)parallelFilter:(BOOL (^)(id value))block;
+
+/// Reduces the values in the sequence, using every available core.
+///
+/// The sequence is evaluated eagerly, then split into chunks. Each chunk is
+/// folded left from `identity` concurrently, and the results of the chunks are
+/// then folded left from `identity` in order. The result only matches
+/// -foldLeftWithStart:reduce: if `combine` is associative and `identity` leaves
+/// any value unchanged when combined with it.
+///
+/// identity - The identity value of `combine`, like 0 for addition.
+/// combine  - An associative block which combines two values, or the results
+///            of combining values. It may be invoked concurrently from many
+///            threads. Cannot be nil.
+///
+/// Returns the reduced value, or `identity` if the sequence is empty.
+- (id)parallelReduceWithIdentity:(id)identity combine:(id (^)(id left, id right))combine;
+
 /// Creates a sequence that dynamically generates its values.
 ///
 /// headBlock - Invoked the first time -head is accessed.
@@ -8,22 +8,126 @@
 
 #import "RACSequence.h"
 #import "RACArraySequence.h"
+#import "RACCompoundDisposable.h"
+#import "RACDemand.h"
+#import "RACDisposable.h"
 #import "RACDynamicSequence.h"
 #import "RACEagerSequence.h"
 #import "RACEmptySequence.h"
 #import "RACScheduler.h"
+#import "RACSerialDisposable.h"
 #import "RACSignal.h"
 #import "RACSubscriber.h"
 #import "RACTuple.h"
 #import "RACUnarySequence.h"
+#import <libkern/OSAtomic.h>
+
+// Stored in `extra[1]` of an NSFastEnumerationState by RACSequence's own
+// implementation of fast enumeration, which retains the current sequence in
+// `state`. Subclasses which override fast enumeration leave it zeroed.
+static const unsigned long RACSequenceEnumerationRetainsState = 1;
+
+// The number of values to request from the sequence at a time, while sending
+// batches.
+#define RACSequenceBatchBufferLength 16
+
+// The number of values to pull through a fused pipeline at a time.
+#define RACFusedSequenceBufferLength 16
+
+// Releases the sequence retained by RACSequence's own implementation of fast
+// enumeration, in case the enumeration was abandoned partway through.
+static void RACSequenceAbandonEnumerationState(NSFastEnumerationState *state) {
+	if (state->extra[1] == RACSequenceEnumerationRetainsState && state->state != 0 && state->state != ULONG_MAX) {
+		CFRelease((CFTypeRef)state->state);
+	}
+}
+
+typedef enum : NSUInteger {
+	RACFusedSequenceStageKindMap,
+	RACFusedSequenceStageKindFilter,
+	RACFusedSequenceStageKindTake,
+} RACFusedSequenceStageKind;
+
+// A single -map:, -filter: or -take: applied to a source sequence.
+@interface RACFusedSequenceStage : NSObject
+
+@property (nonatomic, assign, readonly) RACFusedSequenceStageKind kind;
+
+// The block given to -map: or -filter:.
+@property (nonatomic, copy, readonly) id block;
+
+// The count given to -take:.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+- (id)initWithKind:(RACFusedSequenceStageKind)kind block:(id)block count:(NSUInteger)count;
+
+@end
+
+// Private class that applies a -map:, -filter: or -take: to the values of
+// a source sequence.
+//
+// Results are memoized in a RACFusedSequenceEvaluation, which is shared by the
+// sequence and all of its tails, so each value is only evaluated once. The
+// evaluation pulls values from the source with fast enumeration, in batches,
+// instead of creating intermediate sequences for every value. Enumerating the
+// last of a chain of these sequences therefore pulls batches through every
+// earlier one.
+@interface RACFusedSequence : RACSequence
+
+// Returns a sequence which applies `stage` to the values of `source`.
++ (RACSequence *)sequenceWithSource:(RACSequence *)source stage:(RACFusedSequenceStage *)stage;
+
+@end
+
+// The memoized results of a RACFusedSequence.
+//
+// This class is thread-safe.
+@interface RACFusedSequenceEvaluation : NSObject
+
+- (id)initWithSource:(RACSequence *)source stage:(RACFusedSequenceStage *)stage;
+
+// Evaluates the stage until at least one result is available at `index`, then
+// copies up to `count` of the results starting at `index` into `buffer`.
+//
+// A single batch of values may be pulled from the source to fill `buffer`
+// beyond the first result. Results are retained by the receiver for as long
+// as it exists.
+//
+// Returns the number of results copied, which is only zero if there are no
+// results at or after `index`.
+- (NSUInteger)getResults:(__unsafe_unretained id *)buffer fromIndex:(NSUInteger)index count:(NSUInteger)count;
+
+@end
+
+// Sends the values of a sequence to a subscriber in batches, resuming a single
+// fast enumeration across scheduled blocks.
+@interface RACSequenceBatchEmission : NSObject {
+	NSFastEnumerationState _state;
+
+	// Only used while sending a batch. Values are never kept in here across
+	// scheduled blocks, since they may be autoreleased.
+	__unsafe_unretained id _buffer[RACSequenceBatchBufferLength];
+}
+
+// Disposes of the emission, and cancels any scheduled batch or wait for
+// demand.
+@property (nonatomic, strong, readonly) RACCompoundDisposable *disposable;
+
+- (id)initWithSequence:(RACSequence *)sequence subscriber:(id<RACSubscriber>)subscriber scheduler:(RACScheduler *)scheduler batchSize:(NSUInteger)batchSize;
+
+// Schedules the next batch of values.
+- (void)scheduleBatch;
+
+@end
 
 // An enumerator over sequences.
 @interface RACSequenceEnumerator : NSEnumerator
 
 // The sequence the enumerator is enumerating.
 //
-// This will change as the enumerator is exhausted. This property should only be
-// accessed while synchronized on self.
+// This will change as the enumerator is exhausted. Like any NSEnumerator, the
+// enumerator must not be advanced from multiple threads at once. The sequences
+// themselves are thread-safe, so no other locking is needed.
 @property (nonatomic, strong) RACSequence *sequence;
 
 @end
@@ -43,13 +147,11 @@
 @implementation RACSequenceEnumerator
 
 - (id)nextObject {
-	id object = nil;
-	
-	@synchronized (self) {
-		object = self.sequence.head;
-		self.sequence = self.sequence.tail;
-	}
-	
+	RACSequence *sequence = self.sequence;
+
+	id object = sequence.head;
+	self.sequence = sequence.tail;
+
 	return object;
 }
 
@@ -138,6 +240,27 @@
 	return sequence;
 }
 
+- (instancetype)map:(id (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	RACFusedSequenceStage *stage = [[RACFusedSequenceStage alloc] initWithKind:RACFusedSequenceStageKindMap block:block count:0];
+	return [[RACFusedSequence sequenceWithSource:self stage:stage] setNameWithFormat:@"[%@] -map:", self.name];
+}
+
+- (instancetype)filter:(BOOL (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	RACFusedSequenceStage *stage = [[RACFusedSequenceStage alloc] initWithKind:RACFusedSequenceStageKindFilter block:block count:0];
+	return [[RACFusedSequence sequenceWithSource:self stage:stage] setNameWithFormat:@"[%@] -filter:", self.name];
+}
+
+- (instancetype)take:(NSUInteger)count {
+	if (count == 0) return self.class.empty;
+
+	RACFusedSequenceStage *stage = [[RACFusedSequenceStage alloc] initWithKind:RACFusedSequenceStageKindTake block:nil count:count];
+	return [[RACFusedSequence sequenceWithSource:self stage:stage] setNameWithFormat:@"[%@] -take: %lu", self.name, (unsigned long)count];
+}
+
 - (instancetype)concat:(RACStream *)stream {
 	NSCParameterAssert(stream != nil);
 
@@ -187,25 +310,54 @@
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		__block RACSequence *sequence = self;
 
-		return [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+		// If the subscriber has advertised a demand, values are only sent while
+		// it's outstanding.
+		RACDemand *demand = [RACDemand demandForSubscriber:subscriber];
+
+		// Cancels any pending wait for demand.
+		RACSerialDisposable *demandDisposable = [[RACSerialDisposable alloc] init];
+
+		RACDisposable *schedulingDisposable = [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
 			if (sequence.head == nil) {
 				[subscriber sendCompleted];
 				return;
 			}
 
+			if (demand != nil && demand.outstandingCount == 0) {
+				demandDisposable.disposable = [demand performWhenRequested:reschedule];
+				return;
+			}
+
 			[subscriber sendNext:sequence.head];
 
 			sequence = sequence.tail;
 			reschedule();
 		}];
+
+		if (demand == nil) return schedulingDisposable;
+
+		return [RACDisposable disposableWithBlock:^{
+			[schedulingDisposable dispose];
+			[demandDisposable dispose];
+		}];
 	}] setNameWithFormat:@"[%@] -signalWithScheduler: %@", self.name, scheduler];
 }
 
+- (RACSignal *)signalWithScheduler:(RACScheduler *)scheduler batchSize:(NSUInteger)batchSize {
+	NSCParameterAssert(scheduler != nil);
+	NSCParameterAssert(batchSize > 0);
+
+	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		RACSequenceBatchEmission *emission = [[RACSequenceBatchEmission alloc] initWithSequence:self subscriber:subscriber scheduler:scheduler batchSize:batchSize];
+		[emission scheduleBatch];
+
+		return emission.disposable;
+	}] setNameWithFormat:@"[%@] -signalWithScheduler: %@ batchSize: %lu", self.name, scheduler, (unsigned long)batchSize];
+}
+
 - (id)foldLeftWithStart:(id)start reduce:(id (^)(id, id))reduce {
 	NSCParameterAssert(reduce != NULL);
 
-	if (self.head == nil) return start;
-	
 	for (id value in self) {
 		start = reduce(start, value);
 	}
@@ -216,13 +368,14 @@
 - (id)foldRightWithStart:(id)start reduce:(id (^)(id, RACSequence *))reduce {
 	NSCParameterAssert(reduce != NULL);
 
-	if (self.head == nil) return start;
+	id head = self.head;
+	if (head == nil) return start;
 	
 	RACSequence *rest = [RACSequence sequenceWithHeadBlock:^{
 		return [self.tail foldRightWithStart:start reduce:reduce];
 	} tailBlock:nil];
 	
-	return reduce(self.head, rest);
+	return reduce(head, rest);
 }
 
 - (BOOL)any:(BOOL (^)(id))block {
@@ -247,6 +400,37 @@
 	return [self filter:block].head;
 }
 
+// An empty sequence can't be made into a RACEagerSequence (it's always the
+// shared empty sequence instead), so the parallel operations below handle it
+// directly. Otherwise, they would keep calling themselves on -eagerSequence.
+
+- (RACSequence *)parallelMap:(id (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	RACSequence *eagerSequence = self.eagerSequence;
+	if (eagerSequence.head == nil) return eagerSequence;
+
+	return [eagerSequence parallelMap:block];
+}
+
+- (RACSequence *)parallelFilter:(BOOL (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	RACSequence *eagerSequence = self.eagerSequence;
+	if (eagerSequence.head == nil) return eagerSequence;
+
+	return [eagerSequence parallelFilter:block];
+}
+
+- (id)parallelReduceWithIdentity:(id)identity combine:(id (^)(id, id))combine {
+	NSCParameterAssert(combine != nil);
+
+	RACSequence *eagerSequence = self.eagerSequence;
+	if (eagerSequence.head == nil) return identity;
+
+	return [eagerSequence parallelReduceWithIdentity:identity combine:combine];
+}
+
 - (RACSequence *)eagerSequence {
 	return [RACEagerSequence sequenceWithArray:self.array offset:0];
 }
@@ -310,6 +494,7 @@
 		// Since a sequence doesn't mutate, this just needs to be set to
 		// something non-NULL.
 		state->mutationsPtr = state->extra;
+		state->extra[1] = RACSequenceEnumerationRetainsState;
 
 		setSequence(self);
 	}
@@ -382,3 +567,323 @@
 #pragma clang diagnostic pop
 
 @end
+
+@implementation RACSequenceBatchEmission {
+	RACSequence *_sequence;
+	id<RACSubscriber> _subscriber;
+	RACScheduler *_scheduler;
+	NSUInteger _batchSize;
+
+	// The subscriber's demand, or nil if it hasn't opted into backpressure.
+	RACDemand *_demand;
+
+	RACSerialDisposable *_schedulingDisposable;
+	RACSerialDisposable *_demandDisposable;
+
+	// Guards `_sending` and `_batchPending`.
+	//
+	// -sendBatches can run on any thread which calls -request: on the demand,
+	// when the scheduler runs blocks synchronously.
+	OSSpinLock _sendingLock;
+
+	// Set while batches are being sent, so that schedulers which run blocks
+	// synchronously loop here instead of recursing.
+	BOOL _sending;
+	BOOL _batchPending;
+}
+
+#pragma mark Lifecycle
+
+- (id)initWithSequence:(RACSequence *)sequence subscriber:(id<RACSubscriber>)subscriber scheduler:(RACScheduler *)scheduler batchSize:(NSUInteger)batchSize {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_sequence = sequence;
+	_subscriber = subscriber;
+	_scheduler = scheduler;
+	_batchSize = batchSize;
+	_demand = [RACDemand demandForSubscriber:subscriber];
+	_sendingLock = OS_SPINLOCK_INIT;
+
+	_schedulingDisposable = [[RACSerialDisposable alloc] init];
+	_demandDisposable = [[RACSerialDisposable alloc] init];
+	_disposable = [RACCompoundDisposable compoundDisposableWithDisposables:@[ _schedulingDisposable, _demandDisposable ]];
+
+	return self;
+}
+
+- (void)dealloc {
+	RACSequenceAbandonEnumerationState(&_state);
+}
+
+#pragma mark Sending
+
+- (void)scheduleBatch {
+	if (self.disposable.disposed) return;
+
+	RACDisposable *schedulingDisposable = [_scheduler schedule:^{
+		[self sendBatches];
+	}];
+
+	if (schedulingDisposable != nil) _schedulingDisposable.disposable = schedulingDisposable;
+}
+
+- (void)sendBatches {
+	OSSpinLockLock(&_sendingLock);
+	BOOL alreadySending = _sending;
+	if (alreadySending) {
+		_batchPending = YES;
+	} else {
+		_sending = YES;
+	}
+	OSSpinLockUnlock(&_sendingLock);
+
+	if (alreadySending) return;
+
+	BOOL batchPending;
+	do {
+		@autoreleasepool {
+			[self sendBatch];
+		}
+
+		OSSpinLockLock(&_sendingLock);
+		batchPending = _batchPending;
+		_batchPending = NO;
+
+		// Stop sending while still holding the lock, so that a batch can't be
+		// requested after the check and then dropped.
+		if (!batchPending) _sending = NO;
+		OSSpinLockUnlock(&_sendingLock);
+	} while (batchPending);
+}
+
+- (void)sendBatch {
+	NSUInteger remaining = _batchSize;
+
+	while (remaining > 0) {
+		if (self.disposable.disposed) return;
+
+		if (_demand != nil && _demand.outstandingCount == 0) {
+			_demandDisposable.disposable = [_demand performWhenRequested:^{
+				[self scheduleBatch];
+			}];
+
+			return;
+		}
+
+		// Never request more values than this batch will send, so none are
+		// left over when the autorelease pool drains.
+		NSUInteger length = MIN(remaining, (NSUInteger)RACSequenceBatchBufferLength);
+		if (_demand != nil) length = MIN(length, _demand.outstandingCount);
+
+		NSUInteger count = [_sequence countByEnumeratingWithState:&_state objects:_buffer count:length];
+		if (count == 0) {
+			[_subscriber sendCompleted];
+			return;
+		}
+
+		for (NSUInteger i = 0; i < count; i++) {
+			[_subscriber sendNext:_state.itemsPtr[i]];
+		}
+
+		remaining -= MIN(count, remaining);
+	}
+
+	[self scheduleBatch];
+}
+
+@end
+
+
+@implementation RACFusedSequenceStage
+
+- (id)initWithKind:(RACFusedSequenceStageKind)kind block:(id)block count:(NSUInteger)count {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_kind = kind;
+	_block = [block copy];
+	_count = count;
+
+	return self;
+}
+
+@end
+
+@implementation RACFusedSequence {
+	RACFusedSequenceEvaluation *_evaluation;
+
+	// The index of the receiver's head within the results of `_evaluation`.
+	NSUInteger _offset;
+}
+
+#pragma mark Lifecycle
+
++ (RACSequence *)sequenceWithSource:(RACSequence *)source stage:(RACFusedSequenceStage *)stage {
+	NSCParameterAssert(source != nil);
+	NSCParameterAssert(stage != nil);
+
+	RACFusedSequenceEvaluation *evaluation = [[RACFusedSequenceEvaluation alloc] initWithSource:source stage:stage];
+	return [[self alloc] initWithEvaluation:evaluation offset:0];
+}
+
+- (id)initWithEvaluation:(RACFusedSequenceEvaluation *)evaluation offset:(NSUInteger)offset {
+	NSCParameterAssert(evaluation != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_evaluation = evaluation;
+	_offset = offset;
+
+	return self;
+}
+
+#pragma mark RACSequence
+
+- (id)head {
+	__unsafe_unretained id head = nil;
+	if ([_evaluation getResults:&head fromIndex:_offset count:1] == 0) return nil;
+
+	return head;
+}
+
+- (RACSequence *)tail {
+	if (self.head == nil) return nil;
+
+	return [[RACFusedSequence alloc] initWithEvaluation:_evaluation offset:_offset + 1];
+}
+
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id *)stackbuf count:(NSUInteger)len {
+	if (state->state == 0) {
+		// Since a sequence doesn't mutate, this just needs to be set to
+		// something non-NULL.
+		state->mutationsPtr = state->extra;
+
+		// Track the index of the next result, plus one, so that zero still
+		// means enumeration hasn't started.
+		state->state = _offset + 1;
+	}
+
+	// Don't evaluate too far ahead of the caller, in case it stops early.
+	NSUInteger length = MIN(len, (NSUInteger)RACFusedSequenceBufferLength);
+	NSUInteger count = [_evaluation getResults:stackbuf fromIndex:state->state - 1 count:length];
+
+	state->itemsPtr = stackbuf;
+	state->state += count;
+
+	return count;
+}
+
+@end
+
+@implementation RACFusedSequenceEvaluation {
+	// These ivars should only be accessed while synchronized on self.
+
+	// The sequence to pull values from, or nil once it's been exhausted.
+	RACSequence *_source;
+	RACFusedSequenceStage *_stage;
+
+	// The fast enumeration of `_source`, which is resumed by each batch.
+	NSFastEnumerationState _sourceState;
+	__unsafe_unretained id _sourceBuffer[RACFusedSequenceBufferLength];
+
+	// Every result so far, in order.
+	NSMutableArray *_results;
+}
+
+#pragma mark Lifecycle
+
+- (id)initWithSource:(RACSequence *)source stage:(RACFusedSequenceStage *)stage {
+	NSCParameterAssert(source != nil);
+	NSCParameterAssert(stage != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_source = source;
+	_stage = stage;
+	_results = [NSMutableArray array];
+
+	return self;
+}
+
+- (void)dealloc {
+	RACSequenceAbandonEnumerationState(&_sourceState);
+}
+
+#pragma mark Evaluation
+
+- (NSUInteger)getResults:(__unsafe_unretained id *)buffer fromIndex:(NSUInteger)index count:(NSUInteger)count {
+	NSCParameterAssert(buffer != NULL);
+	NSCParameterAssert(count > 0);
+
+	@synchronized (self) {
+		NSUInteger targetCount = index + count;
+
+		while (_source != nil && _results.count < targetCount) {
+			[self evaluateBatchOfLength:MIN(targetCount - _results.count, (NSUInteger)RACFusedSequenceBufferLength)];
+
+			// Return as soon as anything is available, since a filter might
+			// take arbitrarily long to fill the rest.
+			if (_results.count > index) break;
+		}
+
+		if (index >= _results.count) return 0;
+
+		NSRange range = NSMakeRange(index, MIN(count, _results.count - index));
+		[_results getObjects:buffer range:range];
+
+		return range.length;
+	}
+}
+
+// Pulls up to `length` values from the source, and records the results of
+// the stage.
+//
+// This method should only be invoked while synchronized on self.
+- (void)evaluateBatchOfLength:(NSUInteger)length {
+	// Every value of the source produces at most one result, so this never
+	// evaluates anything that a -take: wouldn't let through.
+	if (_stage.kind == RACFusedSequenceStageKindTake) length = MIN(length, _stage.count - _results.count);
+
+	NSUInteger sourceCount = [_source countByEnumeratingWithState:&_sourceState objects:_sourceBuffer count:length];
+	NSCAssert(sourceCount <= length, @"%@ enumerated %lu values when only %lu were requested", _source, (unsigned long)sourceCount, (unsigned long)length);
+
+	for (NSUInteger i = 0; i < sourceCount; i++) {
+		id value = _sourceState.itemsPtr[i];
+
+		switch (_stage.kind) {
+			case RACFusedSequenceStageKindMap: {
+				id (^block)(id) = _stage.block;
+				value = block(value);
+				break;
+			}
+
+			case RACFusedSequenceStageKindFilter: {
+				BOOL (^block)(id) = _stage.block;
+				if (!block(value)) value = nil;
+				break;
+			}
+
+			case RACFusedSequenceStageKindTake:
+				break;
+		}
+
+		if (value != nil) [_results addObject:value];
+	}
+
+	BOOL finished = (sourceCount == 0);
+	if (_stage.kind == RACFusedSequenceStageKindTake && _results.count >= _stage.count) finished = YES;
+
+	if (finished) {
+		// Let go of the source, since nothing more will be pulled from it.
+		RACSequenceAbandonEnumerationState(&_sourceState);
+		memset(&_sourceState, 0, sizeof(_sourceState));
+		_source = nil;
+	}
+}
+
+@end
@@ -22,6 +22,7 @@ extern const NSInteger RACSignalErrorNoMatchingCase;
 @class RACCommand;
 @class RACDisposable;
 @class RACMulticastConnection;
+@class RACParallelScheduler;
 @class RACScheduler;
 @class RACSequence;
 @class RACSubject;
@@ -585,6 +586,32 @@ extern const NSInteger RACSignalErrorNoMatchingCase;
 /// a RACObserve at view instantiation.
 - (RACSignal *)deliverOnMainThread;
 
+/// Maps each `next` by invoking `block` on the workers of `scheduler`, so that
+/// several values can be mapped at once.
+///
+/// At most four values per worker may be waiting to be mapped or sent at any
+/// time. Once that many are outstanding, further values are queued, and the
+/// thread sending the receiver's values is blocked until they can be scheduled.
+/// Threads which are workers of `scheduler` are never blocked, so that chained
+/// invocations on the same scheduler can't deadlock. Their values just wait in
+/// the queue instead.
+///
+/// Mapped values are sent from the scheduler's workers, but never concurrently.
+///
+/// block     - The block which maps each value. This may be invoked
+///             concurrently from several threads, so it must be thread-safe.
+///             Cannot be nil.
+/// scheduler - The scheduler to map values on. Cannot be nil.
+/// ordered   - Whether mapped values should be sent in the same order as the
+///             values they were mapped from. If NO, each value is sent as soon
+///             as it has been mapped.
+///
+/// Returns a signal which sends the mapped values, and completes once the
+/// receiver has completed and every value has been sent. Errors from the
+/// receiver are forwarded immediately, and any values which haven't been sent
+/// yet are discarded.
+- (RACSignal *)parallelMap:(id (^)(id value))block onScheduler:(RACParallelScheduler *)scheduler ordered:(BOOL)ordered;
+
 /// Groups each received object into a group, as determined by calling `keyBlock`
 /// with that object. The object sent is transformed by calling `transformBlock`
 /// with the object. If `transformBlock` is nil, it sends the original object.
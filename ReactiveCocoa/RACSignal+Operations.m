@@ -7,16 +7,20 @@
 //
 
 #import "RACSignal+Operations.h"
+#import "EXTScope.h"
 #import "NSObject+RACDeallocating.h"
 #import "NSObject+RACDescription.h"
 #import "RACBlockTrampoline.h"
 #import "RACCommand.h"
 #import "RACCompoundDisposable.h"
+#import "RACDemand.h"
 #import "RACDisposable.h"
 #import "RACEvent.h"
 #import "RACGroupedSignal.h"
 #import "RACMulticastConnection+Private.h"
+#import "RACParallelScheduler+Private.h"
 #import "RACReplaySubject.h"
+#import "RACScheduler+Private.h"
 #import "RACScheduler.h"
 #import "RACSerialDisposable.h"
 #import "RACSignalSequence.h"
@@ -88,6 +92,8 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 - (RACSignal *)doNext:(void (^)(id x))block {
 	NSCParameterAssert(block != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		return [self subscribeNext:^(id x) {
 			block(x);
@@ -97,12 +103,17 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 		} completed:^{
 			[subscriber sendCompleted];
 		}];
-	}] setNameWithFormat:@"[%@] -doNext:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -doNext:", self.name];
+	}];
 }
 
 - (RACSignal *)doError:(void (^)(NSError *error))block {
 	NSCParameterAssert(block != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		return [self subscribeNext:^(id x) {
 			[subscriber sendNext:x];
@@ -112,12 +123,17 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 		} completed:^{
 			[subscriber sendCompleted];
 		}];
-	}] setNameWithFormat:@"[%@] -doError:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -doError:", self.name];
+	}];
 }
 
 - (RACSignal *)doCompleted:(void (^)(void))block {
 	NSCParameterAssert(block != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		return [self subscribeNext:^(id x) {
 			[subscriber sendNext:x];
@@ -127,19 +143,31 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			block();
 			[subscriber sendCompleted];
 		}];
-	}] setNameWithFormat:@"[%@] -doCompleted:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -doCompleted:", self.name];
+	}];
 }
 
 - (RACSignal *)throttle:(NSTimeInterval)interval {
+	@weakify(self);
+
 	return [[self throttle:interval valuesPassingTest:^(id _) {
 		return YES;
-	}] setNameWithFormat:@"[%@] -throttle: %f", self.name, (double)interval];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -throttle: %f", self.name, (double)interval];
+	}];
 }
 
 - (RACSignal *)throttle:(NSTimeInterval)interval valuesPassingTest:(BOOL (^)(id next))predicate {
 	NSCParameterAssert(interval >= 0);
 	NSCParameterAssert(predicate != nil);
 
+	uint64_t delay = RACSchedulerNanosecondsWithTimeInterval(interval);
+
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACCompoundDisposable *compoundDisposable = [RACCompoundDisposable compoundDisposable];
 
@@ -177,7 +205,7 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 				nextValue = x;
 				hasNextValue = YES;
-				nextDisposable.disposable = [delayScheduler afterDelay:interval schedule:^{
+				nextDisposable.disposable = [delayScheduler afterNanoseconds:delay schedule:^{
 					flushNext(YES);
 				}];
 			}
@@ -191,10 +219,17 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 		[compoundDisposable addDisposable:subscriptionDisposable];
 		return compoundDisposable;
-	}] setNameWithFormat:@"[%@] -throttle: %f valuesPassingTest:", self.name, (double)interval];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -throttle: %f valuesPassingTest:", self.name, (double)interval];
+	}];
 }
 
 - (RACSignal *)delay:(NSTimeInterval)interval {
+	uint64_t delay = RACSchedulerNanosecondsWithTimeInterval(interval);
+
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
 
@@ -204,7 +239,7 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 		void (^schedule)(dispatch_block_t) = ^(dispatch_block_t block) {
 			RACScheduler *delayScheduler = RACScheduler.currentScheduler ?: scheduler;
-			RACDisposable *schedulerDisposable = [delayScheduler afterDelay:interval schedule:block];
+			RACDisposable *schedulerDisposable = [delayScheduler afterNanoseconds:delay schedule:block];
 			[disposable addDisposable:schedulerDisposable];
 		};
 
@@ -222,10 +257,15 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 		[disposable addDisposable:subscriptionDisposable];
 		return disposable;
-	}] setNameWithFormat:@"[%@] -delay: %f", self.name, (double)interval];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -delay: %f", self.name, (double)interval];
+	}];
 }
 
 - (RACSignal *)repeat {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		return subscribeForever(self,
 			^(id x) {
@@ -238,12 +278,17 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			^(RACDisposable *disposable) {
 				// Resubscribe.
 			});
-	}] setNameWithFormat:@"[%@] -repeat", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -repeat", self.name];
+	}];
 }
 
 - (RACSignal *)catch:(RACSignal * (^)(NSError *error))catchBlock {
 	NSCParameterAssert(catchBlock != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACSerialDisposable *catchDisposable = [[RACSerialDisposable alloc] init];
 
@@ -261,47 +306,72 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			[catchDisposable dispose];
 			[subscriptionDisposable dispose];
 		}];
-	}] setNameWithFormat:@"[%@] -catch:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -catch:", self.name];
+	}];
 }
 
 - (RACSignal *)catchTo:(RACSignal *)signal {
+	@weakify(self);
+
 	return [[self catch:^(NSError *error) {
 		return signal;
-	}] setNameWithFormat:@"[%@] -catchTo: %@", self.name, signal];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -catchTo: %@", self.name, signal];
+	}];
 }
 
 - (RACSignal *)try:(BOOL (^)(id value, NSError **errorPtr))tryBlock {
 	NSCParameterAssert(tryBlock != NULL);
 
+	@weakify(self);
+
 	return [[self flattenMap:^(id value) {
 		NSError *error = nil;
 		BOOL passed = tryBlock(value, &error);
 		return (passed ? [RACSignal return:value] : [RACSignal error:error]);
-	}] setNameWithFormat:@"[%@] -try:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -try:", self.name];
+	}];
 }
 
 - (RACSignal *)tryMap:(id (^)(id value, NSError **errorPtr))mapBlock {
 	NSCParameterAssert(mapBlock != NULL);
 
+	@weakify(self);
+
 	return [[self flattenMap:^(id value) {
 		NSError *error = nil;
 		id mappedValue = mapBlock(value, &error);
 		return (mappedValue == nil ? [RACSignal error:error] : [RACSignal return:mappedValue]);
-	}] setNameWithFormat:@"[%@] -tryMap:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -tryMap:", self.name];
+	}];
 }
 
 - (RACSignal *)initially:(void (^)(void))block {
 	NSCParameterAssert(block != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal defer:^{
 		block();
 		return self;
-	}] setNameWithFormat:@"[%@] -initially:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -initially:", self.name];
+	}];
 }
 
 - (RACSignal *)finally:(void (^)(void))block {
 	NSCParameterAssert(block != NULL);
 
+	@weakify(self);
+
 	return [[[self
 		doError:^(NSError *error) {
 			block();
@@ -309,13 +379,20 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 		doCompleted:^{
 			block();
 		}]
-		setNameWithFormat:@"[%@] -finally:", self.name];
+		setNameWithBlock:^{
+			@strongify(self);
+			return [NSString stringWithFormat:@"[%@] -finally:", self.name];
+		}];
 }
 
 - (RACSignal *)bufferWithTime:(NSTimeInterval)interval onScheduler:(RACScheduler *)scheduler {
 	NSCParameterAssert(scheduler != nil);
 	NSCParameterAssert(scheduler != RACScheduler.immediateScheduler);
 
+	uint64_t delay = RACSchedulerNanosecondsWithTimeInterval(interval);
+
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACSerialDisposable *timerDisposable = [[RACSerialDisposable alloc] init];
 		NSMutableArray *values = [NSMutableArray array];
@@ -335,7 +412,7 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 		RACDisposable *selfDisposable = [self subscribeNext:^(id x) {
 			@synchronized (values) {
 				if (values.count == 0) {
-					timerDisposable.disposable = [scheduler afterDelay:interval schedule:flushValues];
+					timerDisposable.disposable = [scheduler afterNanoseconds:delay schedule:flushValues];
 				}
 
 				[values addObject:x ?: RACTupleNil.tupleNil];
@@ -351,19 +428,29 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			[selfDisposable dispose];
 			[timerDisposable dispose];
 		}];
-	}] setNameWithFormat:@"[%@] -bufferWithTime: %f onScheduler: %@", self.name, (double)interval, scheduler];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -bufferWithTime: %f onScheduler: %@", self.name, (double)interval, scheduler];
+	}];
 }
 
 - (RACSignal *)collect {
+	@weakify(self);
+
 	return [[self aggregateWithStartFactory:^{
 		return [[NSMutableArray alloc] init];
 	} reduce:^(NSMutableArray *collectedValues, id x) {
 		[collectedValues addObject:(x ?: NSNull.null)];
 		return collectedValues;
-	}] setNameWithFormat:@"[%@] -collect", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -collect", self.name];
+	}];
 }
 
 - (RACSignal *)takeLast:(NSUInteger)count {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		NSMutableArray *valuesTaken = [NSMutableArray arrayWithCapacity:count];
 		return [self subscribeNext:^(id x) {
@@ -381,12 +468,17 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 			[subscriber sendCompleted];
 		}];
-	}] setNameWithFormat:@"[%@] -takeLast: %lu", self.name, (unsigned long)count];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -takeLast: %lu", self.name, (unsigned long)count];
+	}];
 }
 
 - (RACSignal *)combineLatestWith:(RACSignal *)signal {
 	NSCParameterAssert(signal != nil);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
 
@@ -436,12 +528,68 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 		[disposable addDisposable:otherDisposable];
 
 		return disposable;
-	}] setNameWithFormat:@"[%@] -combineLatestWith: %@", self.name, signal];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -combineLatestWith: %@", self.name, signal];
+	}];
 }
 
 + (RACSignal *)combineLatest:(id<NSFastEnumeration>)signals {
-	return [[self join:signals block:^(RACSignal *left, RACSignal *right) {
-		return [left combineLatestWith:right];
+	// Enumerate once up front, since `signals` may be a one-shot enumerator.
+	NSMutableArray *signalsArray = [NSMutableArray array];
+	for (RACSignal *signal in signals) {
+		[signalsArray addObject:signal];
+	}
+
+	if (signalsArray.count == 0) return [[self empty] setNameWithFormat:@"+combineLatest: %@", signals];
+
+	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		NSUInteger count = signalsArray.count;
+		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
+
+		// The latest value from each signal, with nils (or missing values)
+		// represented by RACTupleNil.
+		//
+		// This array, and the counters below, should only be used while
+		// synchronized on the array.
+		NSMutableArray *latestValues = [NSMutableArray arrayWithCapacity:count];
+		for (NSUInteger i = 0; i < count; i++) {
+			[latestValues addObject:RACTupleNil.tupleNil];
+		}
+
+		// The number of signals which haven't sent a value yet.
+		__block NSUInteger valuelessCount = count;
+
+		// The number of signals which haven't completed yet.
+		__block NSUInteger incompleteCount = count;
+
+		for (NSUInteger index = 0; index < count; index++) {
+			__block BOOL hasValue = NO;
+
+			RACDisposable *signalDisposable = [signalsArray[index] subscribeNext:^(id x) {
+				@synchronized (latestValues) {
+					latestValues[index] = x ?: RACTupleNil.tupleNil;
+
+					if (!hasValue) {
+						hasValue = YES;
+						valuelessCount--;
+					}
+
+					if (valuelessCount > 0) return;
+					[subscriber sendNext:[RACTuple tupleWithObjectsFromArray:latestValues]];
+				}
+			} error:^(NSError *error) {
+				[subscriber sendError:error];
+			} completed:^{
+				@synchronized (latestValues) {
+					if (--incompleteCount == 0) [subscriber sendCompleted];
+				}
+			}];
+
+			[disposable addDisposable:signalDisposable];
+		}
+
+		return disposable;
 	}] setNameWithFormat:@"+combineLatest: %@", signals];
 }
 
@@ -459,9 +607,14 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 }
 
 - (RACSignal *)merge:(RACSignal *)signal {
+	@weakify(self);
+
 	return [[RACSignal
 		merge:@[ self, signal ]]
-		setNameWithFormat:@"[%@] -merge: %@", self.name, signal];
+		setNameWithBlock:^{
+			@strongify(self);
+			return [NSString stringWithFormat:@"[%@] -merge: %@", self.name, signal];
+		}];
 }
 
 + (RACSignal *)merge:(id<NSFastEnumeration>)signals {
@@ -484,50 +637,88 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 }
 
 - (RACSignal *)flatten:(NSUInteger)maxConcurrent {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACCompoundDisposable *compoundDisposable = [[RACCompoundDisposable alloc] init];
 
-		// Contains disposables for the currently active subscriptions.
+		// Protects the bookkeeping variables below.
 		//
-		// This should only be used while synchronized on `subscriber`.
-		NSMutableArray *activeDisposables = [[NSMutableArray alloc] initWithCapacity:maxConcurrent];
+		// This is deliberately separate from `subscriber`, so that it's never
+		// contended by anything else synchronizing on the subscriber, and is
+		// never held while sending events.
+		__block OSSpinLock lock = OS_SPINLOCK_INIT;
+
+		// The number of currently active subscriptions.
+		//
+		// This should only be used while `lock` is held.
+		__block NSUInteger activeCount = 0;
 
 		// Whether the signal-of-signals has completed yet.
 		//
-		// This should only be used while synchronized on `subscriber`.
+		// This should only be used while `lock` is held.
 		__block BOOL selfCompleted = NO;
 
+		// The signals waiting to be started, beginning at `queueHead`.
+		//
+		// Entries before `queueHead` have already been dequeued, and are
+		// trimmed in batches, so that dequeuing is amortized O(1).
+		//
+		// These should only be used while `lock` is held.
+		NSMutableArray *queuedSignals = [NSMutableArray array];
+		__block NSUInteger queueHead = 0;
+
+		// Removes and returns the oldest queued signal, or nil if there are
+		// none.
+		//
+		// This should only be used while `lock` is held.
+		RACSignal * (^dequeueSignal)(void) = ^ RACSignal * {
+			if (queueHead == queuedSignals.count) return nil;
+
+			RACSignal *signal = queuedSignals[queueHead];
+			queuedSignals[queueHead++] = NSNull.null;
+
+			if (queueHead == queuedSignals.count) {
+				[queuedSignals removeAllObjects];
+				queueHead = 0;
+			} else if (queueHead >= 32 && queueHead * 2 >= queuedSignals.count) {
+				[queuedSignals removeObjectsInRange:NSMakeRange(0, queueHead)];
+				queueHead = 0;
+			}
+
+			return signal;
+		};
+
 		// Subscribes to the given signal.
+		//
+		// The caller must already have counted the subscription in
+		// `activeCount`.
 		__block void (^subscribeToSignal)(RACSignal *);
 
 		// Weak reference to the above, to avoid a leak.
 		__weak __block void (^recur)(RACSignal *);
 
-		// Sends completed to the subscriber if all signals are finished.
-		//
-		// This should only be used while synchronized on `subscriber`.
-		void (^completeIfAllowed)(void) = ^{
-			if (selfCompleted && activeDisposables.count == 0) {
-				[subscriber sendCompleted];
+		// Sends completed to the subscriber, once the signal-of-signals and all
+		// of the signals it sent are finished.
+		void (^complete)(void) = ^{
+			[subscriber sendCompleted];
 
-				// A strong reference is held to `subscribeToSignal` until completion,
-				// preventing it from deallocating early.
-				subscribeToSignal = nil;
-			}
+			// A strong reference is held to `subscribeToSignal` until completion,
+			// preventing it from deallocating early.
+			subscribeToSignal = nil;
 		};
 
-		// The signals waiting to be started.
+		// Only asks the receiver for as many signals as there are free slots, so
+		// that `queuedSignals` stays bounded if the receiver supports
+		// backpressure.
 		//
-		// This array should only be used while synchronized on `subscriber`.
-		NSMutableArray *queuedSignals = [NSMutableArray array];
+		// This is nil if concurrency is unbounded.
+		RACDemand *upstreamDemand = (maxConcurrent > 0 ? [[RACDemand alloc] init] : nil);
+		[upstreamDemand request:maxConcurrent];
 
 		recur = subscribeToSignal = ^(RACSignal *signal) {
 			RACSerialDisposable *serialDisposable = [[RACSerialDisposable alloc] init];
-
-			@synchronized (subscriber) {
-				[compoundDisposable addDisposable:serialDisposable];
-				[activeDisposables addObject:serialDisposable];
-			}
+			[compoundDisposable addDisposable:serialDisposable];
 
 			serialDisposable.disposable = [signal subscribeNext:^(id x) {
 				[subscriber sendNext:x];
@@ -535,91 +726,133 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 				[subscriber sendError:error];
 			} completed:^{
 				__strong void (^subscribeToSignal)(RACSignal *) = recur;
-				RACSignal *nextSignal;
+				[compoundDisposable removeDisposable:serialDisposable];
 
-				@synchronized (subscriber) {
-					[compoundDisposable removeDisposable:serialDisposable];
-					[activeDisposables removeObjectIdenticalTo:serialDisposable];
+				OSSpinLockLock(&lock);
 
-					if (queuedSignals.count == 0) {
-						completeIfAllowed();
-						return;
-					}
+				// If another signal is waiting, it takes over this slot.
+				RACSignal *nextSignal = dequeueSignal();
+				if (nextSignal == nil) activeCount--;
 
-					nextSignal = queuedSignals[0];
-					[queuedSignals removeObjectAtIndex:0];
-				}
+				BOOL shouldComplete = (selfCompleted && activeCount == 0);
+
+				OSSpinLockUnlock(&lock);
 
-				subscribeToSignal(nextSignal);
+				if (nextSignal != nil) subscribeToSignal(nextSignal);
+				if (shouldComplete) complete();
+
+				// A slot has freed up, so the receiver can send another signal.
+				[upstreamDemand request:1];
 			}];
 		};
 
-		[compoundDisposable addDisposable:[self subscribeNext:^(RACSignal *signal) {
-			if (signal == nil) return;
+		RACSubscriber *selfSubscriber = [RACSubscriber subscriberWithNext:^(RACSignal *signal) {
+			if (signal == nil) {
+				// The nil value used up a unit of demand without taking a slot,
+				// so give it back.
+				[upstreamDemand request:1];
+				return;
+			}
 
 			NSCAssert([signal isKindOfClass:RACSignal.class], @"Expected a RACSignal, got %@", signal);
 
-			@synchronized (subscriber) {
-				if (maxConcurrent > 0 && activeDisposables.count >= maxConcurrent) {
-					[queuedSignals addObject:signal];
+			OSSpinLockLock(&lock);
 
-					// If we need to wait, skip subscribing to this
-					// signal.
-					return;
-				}
+			BOOL shouldWait = (maxConcurrent > 0 && activeCount >= maxConcurrent);
+			if (shouldWait) {
+				[queuedSignals addObject:signal];
+			} else {
+				activeCount++;
 			}
 
+			OSSpinLockUnlock(&lock);
+
+			// If we need to wait, skip subscribing to this signal.
+			if (shouldWait) return;
+
 			subscribeToSignal(signal);
 		} error:^(NSError *error) {
 			[subscriber sendError:error];
 		} completed:^{
-			@synchronized (subscriber) {
-				selfCompleted = YES;
-				completeIfAllowed();
-			}
-		}]];
+			OSSpinLockLock(&lock);
+			selfCompleted = YES;
+			BOOL shouldComplete = (activeCount == 0);
+			OSSpinLockUnlock(&lock);
+
+			if (shouldComplete) complete();
+		} demand:upstreamDemand];
+
+		[compoundDisposable addDisposable:[self subscribe:selfSubscriber]];
 
 		return compoundDisposable;
-	}] setNameWithFormat:@"[%@] -flatten: %lu", self.name, (unsigned long)maxConcurrent];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -flatten: %lu", self.name, (unsigned long)maxConcurrent];
+	}];
 }
 
 - (RACSignal *)then:(RACSignal * (^)(void))block {
 	NSCParameterAssert(block != nil);
 
+	@weakify(self);
+
 	return [[[self
 		ignoreValues]
 		concat:[RACSignal defer:block]]
-		setNameWithFormat:@"[%@] -then:", self.name];
+		setNameWithBlock:^{
+			@strongify(self);
+			return [NSString stringWithFormat:@"[%@] -then:", self.name];
+		}];
 }
 
 - (RACSignal *)concat {
-	return [[self flatten:1] setNameWithFormat:@"[%@] -concat", self.name];
+	@weakify(self);
+
+	return [[self flatten:1] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -concat", self.name];
+	}];
 }
 
 - (RACSignal *)aggregateWithStartFactory:(id (^)(void))startFactory reduce:(id (^)(id running, id next))reduceBlock {
 	NSCParameterAssert(startFactory != NULL);
 	NSCParameterAssert(reduceBlock != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal defer:^{
 		return [self aggregateWithStart:startFactory() reduce:reduceBlock];
-	}] setNameWithFormat:@"[%@] -aggregateWithStartFactory:reduce:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -aggregateWithStartFactory:reduce:", self.name];
+	}];
 }
 
 - (RACSignal *)aggregateWithStart:(id)start reduce:(id (^)(id running, id next))reduceBlock {
+	@weakify(self);
+
 	return [[self
 		aggregateWithStart:start
 		reduceWithIndex:^(id running, id next, NSUInteger index) {
 			return reduceBlock(running, next);
 		}]
-		setNameWithFormat:@"[%@] -aggregateWithStart: %@ reduce:", self.name, [start rac_description]];
+		setNameWithBlock:^{
+			@strongify(self);
+			return [NSString stringWithFormat:@"[%@] -aggregateWithStart: %@ reduce:", self.name, [start rac_description]];
+		}];
 }
 
 - (RACSignal *)aggregateWithStart:(id)start reduceWithIndex:(id (^)(id, id, NSUInteger))reduceBlock {
+	@weakify(self);
+
 	return [[[[self
 		scanWithStart:start reduceWithIndex:reduceBlock]
 		startWith:start]
 		takeLast:1]
-		setNameWithFormat:@"[%@] -aggregateWithStart: %@ reduceWithIndex:", self.name, [start rac_description]];
+		setNameWithBlock:^{
+			@strongify(self);
+			return [NSString stringWithFormat:@"[%@] -aggregateWithStart: %@ reduceWithIndex:", self.name, [start rac_description]];
+		}];
 }
 
 - (RACDisposable *)setKeyPath:(NSString *)keyPath onObject:(NSObject *)object {
@@ -713,14 +946,19 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 	NSCParameterAssert(scheduler != nil);
 	NSCParameterAssert(scheduler != RACScheduler.immediateScheduler);
 
+	uint64_t intervalInNanoseconds = RACSchedulerNanosecondsWithTimeInterval(interval);
+	uint64_t leewayInNanoseconds = RACSchedulerNanosecondsWithTimeInterval(leeway);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
-		return [scheduler after:[NSDate dateWithTimeIntervalSinceNow:interval] repeatingEvery:interval withLeeway:leeway schedule:^{
+		return [scheduler afterNanoseconds:intervalInNanoseconds repeatingEveryNanoseconds:intervalInNanoseconds withLeewayNanoseconds:leewayInNanoseconds schedule:^{
 			[subscriber sendNext:[NSDate date]];
 		}];
 	}] setNameWithFormat:@"+interval: %f onScheduler: %@ withLeeway: %f", (double)interval, scheduler, (double)leeway];
 }
 
 - (RACSignal *)takeUntil:(RACSignal *)signalTrigger {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
 		void (^triggerCompletion)(void) = ^{
@@ -750,7 +988,10 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 		}
 
 		return disposable;
-	}] setNameWithFormat:@"[%@] -takeUntil: %@", self.name, signalTrigger];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -takeUntil: %@", self.name, signalTrigger];
+	}];
 }
 
 - (RACSignal *)takeUntilReplacement:(RACSignal *)replacement {
@@ -782,6 +1023,8 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 }
 
 - (RACSignal *)switchToLatest {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACMulticastConnection *connection = [self publish];
 
@@ -800,7 +1043,10 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			[subscriptionDisposable dispose];
 			[connectionDisposable dispose];
 		}];
-	}] setNameWithFormat:@"[%@] -switchToLatest", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -switchToLatest", self.name];
+	}];
 }
 
 + (RACSignal *)switch:(RACSignal *)signal cases:(NSDictionary *)cases default:(RACSignal *)defaultSignal {
@@ -910,9 +1156,14 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 - (BOOL)waitUntilCompleted:(NSError **)error {
 	BOOL success = NO;
 
+	@weakify(self);
+
 	[[[self
 		ignoreValues]
-		setNameWithFormat:@"[%@] -waitUntilCompleted:", self.name]
+		setNameWithBlock:^{
+			@strongify(self);
+			return [NSString stringWithFormat:@"[%@] -waitUntilCompleted:", self.name];
+		}]
 		firstOrDefault:nil success:&success error:error];
 
 	return success;
@@ -931,11 +1182,21 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 }
 
 - (RACSequence *)sequence {
-	return [[RACSignalSequence sequenceWithSignal:self] setNameWithFormat:@"[%@] -sequence", self.name];
+	@weakify(self);
+
+	return [[RACSignalSequence sequenceWithSignal:self] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -sequence", self.name];
+	}];
 }
 
 - (RACMulticastConnection *)publish {
-	RACSubject *subject = [[RACSubject subject] setNameWithFormat:@"[%@] -publish", self.name];
+	@weakify(self);
+
+	RACSubject *subject = [[RACSubject subject] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -publish", self.name];
+	}];
 	RACMulticastConnection *connection = [self multicast:subject];
 	return connection;
 }
@@ -947,7 +1208,12 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 }
 
 - (RACSignal *)replay {
-	RACReplaySubject *subject = [[RACReplaySubject subject] setNameWithFormat:@"[%@] -replay", self.name];
+	@weakify(self);
+
+	RACReplaySubject *subject = [[RACReplaySubject subject] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -replay", self.name];
+	}];
 
 	RACMulticastConnection *connection = [self multicast:subject];
 	[connection connect];
@@ -956,7 +1222,12 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 }
 
 - (RACSignal *)replayLast {
-	RACReplaySubject *subject = [[RACReplaySubject replaySubjectWithCapacity:1] setNameWithFormat:@"[%@] -replayLast", self.name];
+	@weakify(self);
+
+	RACReplaySubject *subject = [[RACReplaySubject replaySubjectWithCapacity:1] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -replayLast", self.name];
+	}];
 
 	RACMulticastConnection *connection = [self multicast:subject];
 	[connection connect];
@@ -966,22 +1237,32 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 - (RACSignal *)replayLazily {
 	RACMulticastConnection *connection = [self multicast:[RACReplaySubject subject]];
+
+	@weakify(self);
+
 	return [[RACSignal
 		defer:^{
 			[connection connect];
 			return connection.signal;
 		}]
-		setNameWithFormat:@"[%@] -replayLazily", self.name];
+		setNameWithBlock:^{
+			@strongify(self);
+			return [NSString stringWithFormat:@"[%@] -replayLazily", self.name];
+		}];
 }
 
 - (RACSignal *)timeout:(NSTimeInterval)interval onScheduler:(RACScheduler *)scheduler {
 	NSCParameterAssert(scheduler != nil);
 	NSCParameterAssert(scheduler != RACScheduler.immediateScheduler);
 
+	uint64_t delay = RACSchedulerNanosecondsWithTimeInterval(interval);
+
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
 
-		RACDisposable *timeoutDisposable = [scheduler afterDelay:interval schedule:^{
+		RACDisposable *timeoutDisposable = [scheduler afterNanoseconds:delay schedule:^{
 			[disposable dispose];
 			[subscriber sendError:[NSError errorWithDomain:RACSignalErrorDomain code:RACSignalErrorTimedOut userInfo:nil]];
 		}];
@@ -1000,10 +1281,15 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 		[disposable addDisposable:subscriptionDisposable];
 		return disposable;
-	}] setNameWithFormat:@"[%@] -timeout: %f onScheduler: %@", self.name, (double)interval, scheduler];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -timeout: %f onScheduler: %@", self.name, (double)interval, scheduler];
+	}];
 }
 
 - (RACSignal *)deliverOn:(RACScheduler *)scheduler {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		return [self subscribeNext:^(id x) {
 			[scheduler schedule:^{
@@ -1018,10 +1304,15 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 				[subscriber sendCompleted];
 			}];
 		}];
-	}] setNameWithFormat:@"[%@] -deliverOn: %@", self.name, scheduler];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -deliverOn: %@", self.name, scheduler];
+	}];
 }
 
 - (RACSignal *)subscribeOn:(RACScheduler *)scheduler {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
 
@@ -1033,10 +1324,15 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 		[disposable addDisposable:schedulingDisposable];
 		return disposable;
-	}] setNameWithFormat:@"[%@] -subscribeOn: %@", self.name, scheduler];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -subscribeOn: %@", self.name, scheduler];
+	}];
 }
 
 - (RACSignal *)deliverOnMainThread {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		__block volatile int32_t queueLength = 0;
 		
@@ -1066,12 +1362,219 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 				[subscriber sendCompleted];
 			});
 		}];
-	}] setNameWithFormat:@"[%@] -deliverOnMainThread", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -deliverOnMainThread", self.name];
+	}];
+}
+
+- (RACSignal *)parallelMap:(id (^)(id value))block onScheduler:(RACParallelScheduler *)scheduler ordered:(BOOL)ordered {
+	NSCParameterAssert(block != NULL);
+	NSCParameterAssert(scheduler != nil);
+
+	@weakify(self);
+
+	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
+
+		// Limits the number of values which have been scheduled, but not yet
+		// sent or discarded. Each value takes a slot before being scheduled,
+		// and gives it back once it leaves `buffer`.
+		NSUInteger windowSize = scheduler.workerCount * 4;
+
+		// Signaled whenever values leave `waitingValues`, to wake up a thread
+		// which is blocked sending the receiver's values.
+		dispatch_semaphore_t progress = dispatch_semaphore_create(0);
+
+		// Marks an empty slot in `buffer`.
+		id emptySlot = [[NSObject alloc] init];
+
+		// If `ordered`, holds mapped values which are waiting for earlier ones,
+		// at the index of their original value modulo `windowSize`. Because of
+		// the window, slots can't be reused before they've been emptied.
+		//
+		// All of the variables below should only be used while synchronized on
+		// this array, which also serializes the events sent to `subscriber`.
+		NSMutableArray *buffer = [NSMutableArray arrayWithCapacity:(ordered ? windowSize : 0)];
+		if (ordered) {
+			for (NSUInteger i = 0; i < windowSize; i++) {
+				[buffer addObject:emptySlot];
+			}
+		}
+
+		// Values from the receiver which are waiting for a slot, in order.
+		NSMutableArray *waitingValues = [NSMutableArray array];
+
+		__block NSUInteger nextIndex = 0;
+		__block NSUInteger nextIndexToSend = 0;
+
+		// The number of values holding a slot in the window.
+		__block NSUInteger pendingCount = 0;
+
+		__block BOOL receiverCompleted = NO;
+
+		// Whether the returned signal has errored, completed, or been disposed.
+		__block BOOL terminated = NO;
+
+		// Schedules waiting values for as long as there are free slots.
+		//
+		// This is recursive through the scheduled blocks, so it's declared
+		// ahead of time.
+		__block void (^startWaitingValues)(void);
+
+		// Gives back a slot, and lets the next waiting value take it.
+		void (^releaseSlot)(void) = ^{
+			pendingCount--;
+			startWaitingValues();
+		};
+
+		// Empties `buffer` and `waitingValues`, and gives back the slots of
+		// any buffered values.
+		void (^discardValues)(void) = ^{
+			for (NSUInteger i = 0; i < buffer.count; i++) {
+				if (buffer[i] == emptySlot) continue;
+
+				buffer[i] = emptySlot;
+				pendingCount--;
+			}
+
+			[waitingValues removeAllObjects];
+			dispatch_semaphore_signal(progress);
+		};
+
+		void (^sendCompletedIfDone)(void) = ^{
+			if (terminated || !receiverCompleted || pendingCount > 0 || waitingValues.count > 0) return;
+
+			terminated = YES;
+			[subscriber sendCompleted];
+		};
+
+		void (^mapValue)(id, NSUInteger) = ^(id x, NSUInteger index) {
+			@synchronized (buffer) {
+				// Don't bother mapping values which will never be sent.
+				if (terminated) {
+					pendingCount--;
+					return;
+				}
+			}
+
+			id result = block(x);
+
+			@synchronized (buffer) {
+				if (terminated) {
+					pendingCount--;
+					return;
+				}
+
+				if (!ordered) {
+					releaseSlot();
+					[subscriber sendNext:result];
+				} else {
+					buffer[index % windowSize] = result ?: RACTupleNil.tupleNil;
+
+					// Send every value which is now in order. Sending may
+					// dispose of the subscription, so check each time.
+					while (!terminated) {
+						NSUInteger slot = nextIndexToSend % windowSize;
+						id value = buffer[slot];
+						if (value == emptySlot) break;
+
+						buffer[slot] = emptySlot;
+						nextIndexToSend++;
+						releaseSlot();
+
+						[subscriber sendNext:(value == RACTupleNil.tupleNil ? nil : value)];
+					}
+				}
+
+				sendCompletedIfDone();
+			}
+		};
+
+		startWaitingValues = ^{
+			while (!terminated && waitingValues.count > 0 && pendingCount < windowSize) {
+				id value = waitingValues[0];
+				[waitingValues removeObjectAtIndex:0];
+
+				id x = (value == RACTupleNil.tupleNil ? nil : value);
+				NSUInteger index = nextIndex++;
+				pendingCount++;
+
+				RACSerialDisposable *scheduleDisposable = [[RACSerialDisposable alloc] init];
+				[disposable addDisposable:scheduleDisposable];
+
+				scheduleDisposable.disposable = [scheduler schedule:^{
+					[disposable removeDisposable:scheduleDisposable];
+					mapValue(x, index);
+				}];
+			}
+
+			dispatch_semaphore_signal(progress);
+		};
+
+		[disposable addDisposable:[RACDisposable disposableWithBlock:^{
+			@synchronized (buffer) {
+				terminated = YES;
+				discardValues();
+
+				// Break the retain cycle through the scheduled blocks.
+				startWaitingValues = nil;
+			}
+		}]];
+
+		RACDisposable *subscriptionDisposable = [self subscribeNext:^(id x) {
+			BOOL mustWait;
+
+			@synchronized (buffer) {
+				if (terminated) return;
+
+				[waitingValues addObject:x ?: RACTupleNil.tupleNil];
+				startWaitingValues();
+
+				mustWait = (waitingValues.count > 0);
+			}
+
+			// Block the thread sending values until this one has a slot,
+			// unless it's one of the scheduler's own workers, which may be
+			// needed to free up a slot.
+			if (!mustWait || scheduler.currentThreadWorker) return;
+
+			while (YES) {
+				dispatch_semaphore_wait(progress, DISPATCH_TIME_FOREVER);
+
+				@synchronized (buffer) {
+					if (terminated || waitingValues.count == 0) break;
+				}
+			}
+		} error:^(NSError *error) {
+			@synchronized (buffer) {
+				if (terminated) return;
+
+				terminated = YES;
+				discardValues();
+
+				[subscriber sendError:error];
+			}
+		} completed:^{
+			@synchronized (buffer) {
+				receiverCompleted = YES;
+				sendCompletedIfDone();
+			}
+		}];
+
+		[disposable addDisposable:subscriptionDisposable];
+		return disposable;
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -parallelMap: onScheduler: %@ ordered: %@", self.name, scheduler, ordered ? @"YES" : @"NO"];
+	}];
 }
 
 - (RACSignal *)groupBy:(id<NSCopying> (^)(id object))keyBlock transform:(id (^)(id object))transformBlock {
 	NSCParameterAssert(keyBlock != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		NSMutableDictionary *groups = [NSMutableDictionary dictionary];
 
@@ -1097,22 +1600,37 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 			[groups.allValues makeObjectsPerformSelector:@selector(sendCompleted)];
 		}];
-	}] setNameWithFormat:@"[%@] -groupBy:transform:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -groupBy:transform:", self.name];
+	}];
 }
 
 - (RACSignal *)groupBy:(id<NSCopying> (^)(id object))keyBlock {
-	return [[self groupBy:keyBlock transform:nil] setNameWithFormat:@"[%@] -groupBy:", self.name];
+	@weakify(self);
+
+	return [[self groupBy:keyBlock transform:nil] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -groupBy:", self.name];
+	}];
 }
 
 - (RACSignal *)any {
+	@weakify(self);
+
 	return [[self any:^(id x) {
 		return YES;
-	}] setNameWithFormat:@"[%@] -any", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -any", self.name];
+	}];
 }
 
 - (RACSignal *)any:(BOOL (^)(id object))predicateBlock {
 	NSCParameterAssert(predicateBlock != NULL);
 
+	@weakify(self);
+
 	return [[[self materialize] bind:^{
 		return ^(RACEvent *event, BOOL *stop) {
 			if (event.finished) {
@@ -1127,12 +1645,17 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 			return [RACSignal empty];
 		};
-	}] setNameWithFormat:@"[%@] -any:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -any:", self.name];
+	}];
 }
 
 - (RACSignal *)all:(BOOL (^)(id object))predicateBlock {
 	NSCParameterAssert(predicateBlock != NULL);
 
+	@weakify(self);
+
 	return [[[self materialize] bind:^{
 		return ^(RACEvent *event, BOOL *stop) {
 			if (event.eventType == RACEventTypeCompleted) {
@@ -1147,10 +1670,15 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 			return [RACSignal empty];
 		};
-	}] setNameWithFormat:@"[%@] -all:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -all:", self.name];
+	}];
 }
 
 - (RACSignal *)retry:(NSInteger)retryCount {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		__block NSInteger currentRetryCount = 0;
 		return subscribeForever(self,
@@ -1171,16 +1699,26 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 				[disposable dispose];
 				[subscriber sendCompleted];
 			});
-	}] setNameWithFormat:@"[%@] -retry: %lu", self.name, (unsigned long)retryCount];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -retry: %lu", self.name, (unsigned long)retryCount];
+	}];
 }
 
 - (RACSignal *)retry {
-	return [[self retry:0] setNameWithFormat:@"[%@] -retry", self.name];
+	@weakify(self);
+
+	return [[self retry:0] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -retry", self.name];
+	}];
 }
 
 - (RACSignal *)sample:(RACSignal *)sampler {
 	NSCParameterAssert(sampler != nil);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		NSLock *lock = [[NSLock alloc] init];
 		__block id lastValue;
@@ -1223,16 +1761,26 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			[samplerDisposable dispose];
 			[sourceDisposable dispose];
 		}];
-	}] setNameWithFormat:@"[%@] -sample: %@", self.name, sampler];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -sample: %@", self.name, sampler];
+	}];
 }
 
 - (RACSignal *)ignoreValues {
+	@weakify(self);
+
 	return [[self filter:^(id _) {
 		return NO;
-	}] setNameWithFormat:@"[%@] -ignoreValues", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -ignoreValues", self.name];
+	}];
 }
 
 - (RACSignal *)materialize {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		return [self subscribeNext:^(id x) {
 			[subscriber sendNext:[RACEvent eventWithValue:x]];
@@ -1243,10 +1791,15 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			[subscriber sendNext:RACEvent.completedEvent];
 			[subscriber sendCompleted];
 		}];
-	}] setNameWithFormat:@"[%@] -materialize", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -materialize", self.name];
+	}];
 }
 
 - (RACSignal *)dematerialize {
+	@weakify(self);
+
 	return [[self bind:^{
 		return ^(RACEvent *event, BOOL *stop) {
 			switch (event.eventType) {
@@ -1262,18 +1815,28 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 					return [RACSignal return:event.value];
 			}
 		};
-	}] setNameWithFormat:@"[%@] -dematerialize", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -dematerialize", self.name];
+	}];
 }
 
 - (RACSignal *)not {
+	@weakify(self);
+
 	return [[self map:^(NSNumber *value) {
 		NSCAssert([value isKindOfClass:NSNumber.class], @"-not must only be used on a signal of NSNumbers. Instead, got: %@", value);
 
 		return @(!value.boolValue);
-	}] setNameWithFormat:@"[%@] -not", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -not", self.name];
+	}];
 }
 
 - (RACSignal *)and {
+	@weakify(self);
+
 	return [[self map:^(RACTuple *tuple) {
 		NSCAssert([tuple isKindOfClass:RACTuple.class], @"-and must only be used on a signal of RACTuples of NSNumbers. Instead, received: %@", tuple);
 		NSCAssert(tuple.count > 0, @"-and must only be used on a signal of RACTuples of NSNumbers, with at least 1 value in the tuple");
@@ -1283,10 +1846,15 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 			return number.boolValue;
 		}]);
-	}] setNameWithFormat:@"[%@] -and", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -and", self.name];
+	}];
 }
 
 - (RACSignal *)or {
+	@weakify(self);
+
 	return [[self map:^(RACTuple *tuple) {
 		NSCAssert([tuple isKindOfClass:RACTuple.class], @"-or must only be used on a signal of RACTuples of NSNumbers. Instead, received: %@", tuple);
 		NSCAssert(tuple.count > 0, @"-or must only be used on a signal of RACTuples of NSNumbers, with at least 1 value in the tuple");
@@ -1296,10 +1864,15 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 
 			return number.boolValue;
 		}]);
-	}] setNameWithFormat:@"[%@] -or", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -or", self.name];
+	}];
 }
 
 - (RACSignal *)reduceApply {
+	@weakify(self);
+
 	return [[self map:^(RACTuple *tuple) {
 		NSCAssert([tuple isKindOfClass:RACTuple.class], @"-reduceApply must only be used on a signal of RACTuples. Instead, received: %@", tuple);
 		NSCAssert(tuple.count > 1, @"-reduceApply must only be used on a signal of RACTuples, with at least a block in tuple[0] and its first argument in tuple[1]");
@@ -1312,7 +1885,10 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 		RACTuple *arguments = [RACTuple tupleWithObjectsFromArray:[tupleArray subarrayWithRange:NSMakeRange(1, tupleArray.count - 1)]];
 
 		return [RACBlockTrampoline invokeBlock:tuple[0] withArguments:arguments];
-	}] setNameWithFormat:@"[%@] -reduceApply", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -reduceApply", self.name];
+	}];
 }
 
 @end
@@ -1326,6 +1902,8 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 	NSCParameterAssert(openSignal != nil);
 	NSCParameterAssert(closeBlock != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		__block RACSubject *currentWindow = nil;
 		__block RACSignal *currentCloseWindow = nil;
@@ -1371,11 +1949,17 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			[openObserverDisposable dispose];
 			[selfObserverDisposable dispose];
 		}];
-	}] setNameWithFormat:@"[%@] -windowWithStart: %@ close:", self.name, openSignal];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -windowWithStart: %@ close:", self.name, openSignal];
+	}];
 }
 
 - (RACSignal *)buffer:(NSUInteger)bufferCount {
 	NSCParameterAssert(bufferCount > 0);
+
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		NSMutableArray *values = [NSMutableArray arrayWithCapacity:bufferCount];
 		RACSubject *windowCloseSubject = [RACSubject subject];
@@ -1406,12 +1990,17 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			[outerDisposable dispose];
 			[closeDisposable dispose];
 		}];
-	}] setNameWithFormat:@"[%@] -buffer: %lu", self.name, (unsigned long)bufferCount];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -buffer: %lu", self.name, (unsigned long)bufferCount];
+	}];
 }
 
 - (RACSignal *)let:(RACSignal * (^)(RACSignal *sharedSignal))letBlock {
 	NSCParameterAssert(letBlock != NULL);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACMulticastConnection *connection = [self publish];
 		RACDisposable *finalDisposable = [letBlock(connection.signal) subscribeNext:^(id x) {
@@ -1428,7 +2017,10 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 			[connectionDisposable dispose];
 			[finalDisposable dispose];
 		}];
-	}] setNameWithFormat:@"[%@] -let:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -let:", self.name];
+	}];
 }
 
 + (RACSignal *)interval:(NSTimeInterval)interval {
@@ -9,6 +9,7 @@
 #import <Foundation/Foundation.h>
 #import "RACStream.h"
 
+@class RACDemand;
 @class RACDisposable;
 @class RACScheduler;
 @class RACSubject;
@@ -157,6 +158,20 @@
 /// Convenience method to subscribe to `error` and `completed` events.
 - (RACDisposable *)subscribeError:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock;
 
+/// Convenience method to subscribe to the `next`, `completed`, and `error`
+/// events, while only accepting as many values as `demand` allows.
+///
+/// Signals which support backpressure (like those created with
+/// -[RACSequence signalWithScheduler:]) will wait for outstanding demand before
+/// sending each value. Other signals will send values as usual.
+///
+/// nextBlock      - The block to invoke for each value. This must not be nil.
+/// errorBlock     - The block to invoke upon error. This may be nil.
+/// completedBlock - The block to invoke upon completion. This may be nil.
+/// demand         - The demand to advertise. Call -[RACDemand request:] on this
+///                  object to receive more values. This must not be nil.
+- (RACDisposable *)subscribeNext:(void (^)(id x))nextBlock error:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock demand:(RACDemand *)demand;
+
 @end
 
 /// Additional methods to assist with debugging.
@@ -7,11 +7,15 @@
 //
 
 #import "RACSignal.h"
+#import "EXTScope.h"
+#import "NSObject+RACDescription.h"
+#import "RACBlockTrampoline.h"
 #import "RACCompoundDisposable.h"
 #import "RACDisposable.h"
 #import "RACDynamicSignal.h"
 #import "RACEmptySignal.h"
 #import "RACErrorSignal.h"
+#import "RACFusedSignal.h"
 #import "RACMulticastConnection.h"
 #import "RACReplaySubject.h"
 #import "RACReturnSignal.h"
@@ -21,6 +25,8 @@
 #import "RACSubject.h"
 #import "RACSubscriber+Private.h"
 #import "RACTuple.h"
+#import <libkern/OSAtomic.h>
+#import <objc/runtime.h>
 
 @implementation RACSignal
 
@@ -104,35 +110,40 @@
 	 * If any signal sends an error at any point, send that to the subscriber.
 	 */
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACStreamBindBlock bindingBlock = block();
 
-		NSMutableArray *signals = [NSMutableArray arrayWithObject:self];
+		// The number of signals (including the receiver) which haven't
+		// completed yet.
+		__block volatile int32_t activeCount = 1;
 
 		RACCompoundDisposable *compoundDisposable = [RACCompoundDisposable compoundDisposable];
 
-		void (^completeSignal)(RACSignal *, RACDisposable *) = ^(RACSignal *signal, RACDisposable *finishedDisposable) {
-			BOOL removeDisposable = NO;
-
-			@synchronized (signals) {
-				[signals removeObject:signal];
-
-				if (signals.count == 0) {
-					[subscriber sendCompleted];
-					[compoundDisposable dispose];
-				} else {
-					removeDisposable = YES;
-				}
+		void (^completeSignal)(RACDisposable *) = ^(RACDisposable *finishedDisposable) {
+			if (OSAtomicDecrement32Barrier(&activeCount) == 0) {
+				[subscriber sendCompleted];
+				[compoundDisposable dispose];
+			} else {
+				[compoundDisposable removeDisposable:finishedDisposable];
 			}
-
-			if (removeDisposable) [compoundDisposable removeDisposable:finishedDisposable];
 		};
 
 		void (^addSignal)(RACSignal *) = ^(RACSignal *signal) {
-			@synchronized (signals) {
-				[signals addObject:signal];
+			// Most binding blocks (like those of -flattenMap:) return one of
+			// these, and their events are known ahead of time, so forward them
+			// directly instead of subscribing.
+			Class signalClass = object_getClass(signal);
+			if (signalClass == RACReturnSignal.class) {
+				[subscriber sendNext:((RACReturnSignal *)signal).value];
+				return;
+			} else if (signalClass == RACEmptySignal.class) {
+				return;
 			}
 
+			OSAtomicIncrement32Barrier(&activeCount);
+
 			RACSerialDisposable *selfDisposable = [[RACSerialDisposable alloc] init];
 			[compoundDisposable addDisposable:selfDisposable];
 
@@ -143,7 +154,7 @@
 				[subscriber sendError:error];
 			} completed:^{
 				@autoreleasepool {
-					completeSignal(signal, selfDisposable);
+					completeSignal(selfDisposable);
 				}
 			}];
 
@@ -155,8 +166,9 @@
 			[compoundDisposable addDisposable:selfDisposable];
 
 			RACDisposable *bindingDisposable = [self subscribeNext:^(id x) {
-				// Manually check disposal to handle synchronous errors.
-				if (compoundDisposable.disposed) return;
+				// Manually check disposal to handle synchronous errors, and
+				// synchronous values sent after the binding block stopped.
+				if (compoundDisposable.disposed || selfDisposable.disposed) return;
 
 				BOOL stop = NO;
 				id signal = bindingBlock(x, &stop);
@@ -165,15 +177,18 @@
 					if (signal != nil) addSignal(signal);
 					if (signal == nil || stop) {
 						[selfDisposable dispose];
-						completeSignal(self, selfDisposable);
+						completeSignal(selfDisposable);
 					}
 				}
 			} error:^(NSError *error) {
 				[compoundDisposable dispose];
 				[subscriber sendError:error];
 			} completed:^{
+				// The binding block may have already stopped the receiver.
+				if (selfDisposable.disposed) return;
+
 				@autoreleasepool {
-					completeSignal(self, selfDisposable);
+					completeSignal(selfDisposable);
 				}
 			}];
 
@@ -181,10 +196,186 @@
 		}
 
 		return compoundDisposable;
-	}] setNameWithFormat:@"[%@] -bind:", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -bind:", self.name];
+	}];
+}
+
+// The following operators are fused with any adjacent ones, instead of
+// being built on -bind:, so that a chain of them runs inline with a single
+// subscription.
+
+- (RACSignal *)map:(id (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	RACFusedStage stage = ^(id value, BOOL *skip, BOOL *stop) {
+		return block(value);
+	};
+
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		return stage;
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -map:", self.name];
+	}];
+}
+
+- (RACSignal *)mapReplace:(id)object {
+	RACFusedStage stage = ^(id value, BOOL *skip, BOOL *stop) {
+		return object;
+	};
+
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		return stage;
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -mapReplace: %@", self.name, [object rac_description]];
+	}];
+}
+
+- (RACSignal *)reduceEach:(id (^)())reduceBlock {
+	NSCParameterAssert(reduceBlock != nil);
+
+	__weak RACSignal *signal __attribute__((unused)) = self;
+	RACFusedStage stage = ^(RACTuple *t, BOOL *skip, BOOL *stop) {
+		NSCAssert([t isKindOfClass:RACTuple.class], @"Value from signal %@ is not a tuple: %@", signal, t);
+		return [RACBlockTrampoline invokeBlock:reduceBlock withArguments:t];
+	};
+
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		return stage;
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -reduceEach:", self.name];
+	}];
+}
+
+- (RACSignal *)scanWithStart:(id)startingValue reduce:(id (^)(id running, id next))reduceBlock {
+	NSCParameterAssert(reduceBlock != nil);
+
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		__block id running = startingValue;
+
+		return ^(id value, BOOL *skip, BOOL *stop) {
+			running = reduceBlock(running, value);
+			return running;
+		};
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -scanWithStart: %@ reduce:", self.name, [startingValue rac_description]];
+	}];
+}
+
+- (RACSignal *)scanWithStart:(id)startingValue reduceWithIndex:(id (^)(id running, id next, NSUInteger index))reduceBlock {
+	NSCParameterAssert(reduceBlock != nil);
+
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		__block id running = startingValue;
+		__block NSUInteger index = 0;
+
+		return ^(id value, BOOL *skip, BOOL *stop) {
+			running = reduceBlock(running, value, index++);
+			return running;
+		};
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -scanWithStart: %@ reduceWithIndex:", self.name, [startingValue rac_description]];
+	}];
+}
+
+- (RACSignal *)filter:(BOOL (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	RACFusedStage stage = ^(id value, BOOL *skip, BOOL *stop) {
+		if (!block(value)) *skip = YES;
+		return value;
+	};
+
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		return stage;
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -filter:", self.name];
+	}];
+}
+
+- (RACSignal *)skip:(NSUInteger)skipCount {
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		__block NSUInteger skipped = 0;
+
+		return ^(id value, BOOL *skip, BOOL *stop) {
+			if (skipped < skipCount) {
+				skipped++;
+				*skip = YES;
+			}
+
+			return value;
+		};
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -skip: %lu", self.name, (unsigned long)skipCount];
+	}];
+}
+
+- (RACSignal *)take:(NSUInteger)count {
+	if (count == 0) return [RACSignal empty];
+
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		__block NSUInteger taken = 0;
+
+		return ^(id value, BOOL *skip, BOOL *stop) {
+			if (++taken >= count) *stop = YES;
+			return value;
+		};
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -take: %lu", self.name, (unsigned long)count];
+	}];
+}
+
+- (RACSignal *)distinctUntilChanged {
+	@weakify(self);
+
+	return [[RACFusedSignal signalWithSignal:self stage:^{
+		__block id lastValue = nil;
+		__block BOOL initial = YES;
+
+		return ^(id x, BOOL *skip, BOOL *stop) {
+			if (!initial && (lastValue == x || [x isEqual:lastValue])) {
+				*skip = YES;
+				return x;
+			}
+
+			initial = NO;
+			lastValue = x;
+			return x;
+		};
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -distinctUntilChanged", self.name];
+	}];
 }
 
 - (RACSignal *)concat:(RACSignal *)signal {
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACSerialDisposable *serialDisposable = [[RACSerialDisposable alloc] init];
 
@@ -199,12 +390,17 @@
 
 		serialDisposable.disposable = sourceDisposable;
 		return serialDisposable;
-	}] setNameWithFormat:@"[%@] -concat: %@", self.name, signal];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -concat: %@", self.name, signal];
+	}];
 }
 
 - (RACSignal *)zipWith:(RACSignal *)signal {
 	NSCParameterAssert(signal != nil);
 
+	@weakify(self);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		__block BOOL selfCompleted = NO;
 		NSMutableArray *selfValues = [NSMutableArray array];
@@ -266,7 +462,87 @@
 			[selfDisposable dispose];
 			[otherDisposable dispose];
 		}];
-	}] setNameWithFormat:@"[%@] -zipWith: %@", self.name, signal];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"[%@] -zipWith: %@", self.name, signal];
+	}];
+}
+
++ (RACSignal *)zip:(id<NSFastEnumeration>)signals {
+	// Enumerate once up front, since `signals` may be a one-shot enumerator.
+	NSMutableArray *signalsArray = [NSMutableArray array];
+	for (RACSignal *signal in signals) {
+		[signalsArray addObject:signal];
+	}
+
+	if (signalsArray.count == 0) return [[self empty] setNameWithFormat:@"+zip: %@", signals];
+
+	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		NSUInteger count = signalsArray.count;
+		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
+
+		// The values received from each signal which haven't been sent yet,
+		// with nils represented by RACTupleNil.
+		//
+		// This array, and the variables below, should only be used while
+		// synchronized on the array.
+		NSMutableArray *queues = [NSMutableArray arrayWithCapacity:count];
+		for (NSUInteger i = 0; i < count; i++) {
+			[queues addObject:[NSMutableArray array]];
+		}
+
+		// The number of signals which don't have any values waiting.
+		__block NSUInteger emptyCount = count;
+
+		// The indexes of the signals which have completed.
+		NSMutableIndexSet *completedIndexes = [NSMutableIndexSet indexSet];
+
+		// Sends a tuple of the oldest waiting values, if every signal has one,
+		// then completes if a completed signal has run out of values.
+		void (^sendNextIfPossible)(void) = ^{
+			if (emptyCount > 0) return;
+
+			NSMutableArray *values = [NSMutableArray arrayWithCapacity:count];
+			BOOL exhausted = NO;
+
+			for (NSUInteger i = 0; i < count; i++) {
+				NSMutableArray *queue = queues[i];
+				[values addObject:queue[0]];
+				[queue removeObjectAtIndex:0];
+
+				if (queue.count == 0) {
+					emptyCount++;
+					if ([completedIndexes containsIndex:i]) exhausted = YES;
+				}
+			}
+
+			[subscriber sendNext:[RACTuple tupleWithObjectsFromArray:values]];
+			if (exhausted) [subscriber sendCompleted];
+		};
+
+		for (NSUInteger index = 0; index < count; index++) {
+			RACDisposable *signalDisposable = [signalsArray[index] subscribeNext:^(id x) {
+				@synchronized (queues) {
+					NSMutableArray *queue = queues[index];
+					if (queue.count == 0) emptyCount--;
+
+					[queue addObject:x ?: RACTupleNil.tupleNil];
+					sendNextIfPossible();
+				}
+			} error:^(NSError *error) {
+				[subscriber sendError:error];
+			} completed:^{
+				@synchronized (queues) {
+					[completedIndexes addIndex:index];
+					if ([queues[index] count] == 0) [subscriber sendCompleted];
+				}
+			}];
+
+			[disposable addDisposable:signalDisposable];
+		}
+
+		return disposable;
+	}] setNameWithFormat:@"+zip: %@", signals];
 }
 
 @end
@@ -332,6 +608,14 @@
 	return [self subscribe:o];
 }
 
+- (RACDisposable *)subscribeNext:(void (^)(id x))nextBlock error:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock demand:(RACDemand *)demand {
+	NSCParameterAssert(nextBlock != NULL);
+	NSCParameterAssert(demand != nil);
+
+	RACSubscriber *o = [RACSubscriber subscriberWithNext:nextBlock error:errorBlock completed:completedBlock demand:demand];
+	return [self subscribe:o];
+}
+
 @end
 
 @implementation RACSignal (Debugging)
@@ -341,21 +625,36 @@
 }
 
 - (RACSignal *)logNext {
+	@weakify(self);
+
 	return [[self doNext:^(id x) {
 		NSLog(@"%@ next: %@", self, x);
-	}] setNameWithFormat:@"%@", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"%@", self.name];
+	}];
 }
 
 - (RACSignal *)logError {
+	@weakify(self);
+
 	return [[self doError:^(NSError *error) {
 		NSLog(@"%@ error: %@", self, error);
-	}] setNameWithFormat:@"%@", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"%@", self.name];
+	}];
 }
 
 - (RACSignal *)logCompleted {
+	@weakify(self);
+
 	return [[self doCompleted:^{
 		NSLog(@"%@ completed", self);
-	}] setNameWithFormat:@"%@", self.name];
+	}] setNameWithBlock:^{
+		@strongify(self);
+		return [NSString stringWithFormat:@"%@", self.name];
+	}];
 }
 
 @end
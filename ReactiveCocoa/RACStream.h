@@ -152,6 +152,18 @@ typedef RACStream *(^RACStreamBindBlock)(id value, BOOL *stop);
 // 3/返回一个receiver.（方法链 method chaining）
 - (instancetype)setNameWithFormat:(NSString *)format, ... NS_FORMAT_FUNCTION(1, 2);
 
+/// Sets the name of the receiver to the string returned by the given block.
+///
+/// Unlike -setNameWithFormat:, nothing is formatted (or even evaluated) up
+/// front. The block is only invoked the first time the name is actually read,
+/// and is never retained unless the RAC_DEBUG_SIGNAL_NAMES environment variable
+/// is set.
+///
+/// block - Returns the name of the receiver. This must not be nil.
+///
+/// Returns the receiver, for easy method chaining.
+- (instancetype)setNameWithBlock:(NSString * (^)(void))block;
+
 @end
 
 /// Operations built on the RACStream primitives.
@@ -7,18 +7,33 @@
 //
 
 #import "RACStream.h"
+#import "EXTScope.h"
 #import "NSObject+RACDescription.h"
 #import "RACBlockTrampoline.h"
 #import "RACTuple.h"
+#import <libkern/OSAtomic.h>
+
+@interface RACStream () {
+    // Protects `_name` and `_nameBlock`.
+    OSSpinLock _nameLock;
+
+    // If not nil, renders the name of the stream the next time it's read.
+    NSString * (^_nameBlock)(void);
+}
+
+@end
 
 @implementation RACStream
 
+@synthesize name = _name;
+
 #pragma mark Lifecycle
 
 - (id)init {
     self = [super init];
     if (self == nil) return nil;
 
+    _nameLock = OS_SPINLOCK_INIT;
     self.name = @"";
     return self;
 }
@@ -47,8 +62,72 @@
 
 #pragma mark Naming
 
+- (NSString *)name {
+    OSSpinLockLock(&_nameLock);
+    NSString *name = _name;
+    NSString * (^nameBlock)(void) = _nameBlock;
+    OSSpinLockUnlock(&_nameLock);
+
+    if (nameBlock == nil) return name;
+
+    // Render outside of the lock, since the block will probably read the
+    // names of other streams.
+    name = [nameBlock() copy];
+
+    OSSpinLockLock(&_nameLock);
+    if (_nameBlock == nameBlock) {
+        _name = name;
+        _nameBlock = nil;
+    } else {
+        // The name was changed while rendering, so return the newer one.
+        name = (_nameBlock == nil ? _name : nil);
+    }
+    OSSpinLockUnlock(&_nameLock);
+
+    return name ?: self.name;
+}
+
+- (void)setName:(NSString *)name {
+    name = [name copy];
+
+    OSSpinLockLock(&_nameLock);
+
+    // Swap the old values into locals, so that they're released outside of
+    // the lock.
+    NSString *oldName = _name;
+    NSString * (^oldNameBlock)(void) = _nameBlock;
+
+    _name = name;
+    _nameBlock = nil;
+
+    OSSpinLockUnlock(&_nameLock);
+
+    // Keep the old values alive until now, so that they're released after
+    // unlocking.
+    (void)oldName;
+    (void)oldNameBlock;
+}
+
+- (instancetype)setNameWithBlock:(NSString * (^)(void))block {
+    if (!RACDebugSignalNamesEnabled()) return self;
+
+    NSCParameterAssert(block != nil);
+
+    block = [block copy];
+
+    OSSpinLockLock(&_nameLock);
+    NSString * (^oldNameBlock)(void) = _nameBlock;
+    _nameBlock = block;
+    OSSpinLockUnlock(&_nameLock);
+
+    // Keep the old block alive until now, so that it's released after
+    // unlocking.
+    (void)oldNameBlock;
+    return self;
+}
+
 - (instancetype)setNameWithFormat:(NSString *)format, ... {
-    if (getenv("RAC_DEBUG_SIGNAL_NAMES") == NULL) return self;
+    if (!RACDebugSignalNamesEnabled()) return self;
 
     NSCParameterAssert(format != nil);
 
@@ -69,6 +148,8 @@
 - (instancetype)flattenMap:(RACStream *(^)(id value))block {
     Class class = self.class;
 
+    @weakify(self);
+
     return [[self bind:^{
         return ^(id value, BOOL *stop) {
             id stream = block(value) ?: [class empty];
@@ -76,14 +157,23 @@
 
             return stream;
         };
-    }] setNameWithFormat:@"[%@] -flattenMap:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -flattenMap:", self.name];
+    }];
 }
 
 - (instancetype)flatten {
     __weak RACStream *stream __attribute__((unused)) = self;
+
+    @weakify(self);
+
     return [[self flattenMap:^(id value) {
         return value;
-    }] setNameWithFormat:@"[%@] -flatten", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -flatten", self.name];
+    }];
 }
 
 - (instancetype)map:(id (^)(id value))block {
@@ -91,19 +181,32 @@
 
     Class class = self.class;
 
+    @weakify(self);
+
     return [[self flattenMap:^(id value) {
         return [class return:block(value)];
-    }] setNameWithFormat:@"[%@] -map:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -map:", self.name];
+    }];
 }
 
 - (instancetype)mapReplace:(id)object {
+    @weakify(self);
+
     return [[self map:^(id _) {
         return object;
-    }] setNameWithFormat:@"[%@] -mapReplace: %@", self.name, [object rac_description]];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -mapReplace: %@", self.name, [object rac_description]];
+    }];
 }
 
 - (instancetype)combinePreviousWithStart:(id)start reduce:(id (^)(id previous, id next))reduceBlock {
     NSCParameterAssert(reduceBlock != NULL);
+
+    @weakify(self);
+
     return [[[self
             scanWithStart:RACTuplePack(start)
                    reduce:^(RACTuple *previousTuple, id next) {
@@ -113,7 +216,10 @@
             map:^(RACTuple *tuple) {
                 return tuple[1];
             }]
-            setNameWithFormat:@"[%@] -combinePreviousWithStart: %@ reduce:", self.name, [start rac_description]];
+            setNameWithBlock:^{
+                @strongify(self);
+                return [NSString stringWithFormat:@"[%@] -combinePreviousWithStart: %@ reduce:", self.name, [start rac_description]];
+            }];
 }
 
 - (instancetype)filter:(BOOL (^)(id value))block {
@@ -121,40 +227,63 @@
 
     Class class = self.class;
 
+    @weakify(self);
+
     return [[self flattenMap:^id(id value) {
         if (block(value)) {
             return [class return:value];
         } else {
             return class.empty;
         }
-    }] setNameWithFormat:@"[%@] -filter:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -filter:", self.name];
+    }];
 }
 
 - (instancetype)ignore:(id)value {
+    @weakify(self);
+
     return [[self filter:^BOOL(id innerValue) {
         return innerValue != value && ![innerValue isEqual:value];
-    }] setNameWithFormat:@"[%@] -ignore: %@", self.name, [value rac_description]];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -ignore: %@", self.name, [value rac_description]];
+    }];
 }
 
 - (instancetype)reduceEach:(id (^)())reduceBlock {
     NSCParameterAssert(reduceBlock != nil);
 
     __weak RACStream *stream __attribute__((unused)) = self;
+
+    @weakify(self);
+
     return [[self map:^(RACTuple *t) {
         NSCAssert([t isKindOfClass:RACTuple.class], @"Value from stream %@ is not a tuple: %@", stream, t);
         return [RACBlockTrampoline invokeBlock:reduceBlock withArguments:t];
-    }] setNameWithFormat:@"[%@] -reduceEach:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -reduceEach:", self.name];
+    }];
 }
 
 - (instancetype)startWith:(id)value {
+    @weakify(self);
+
     return [[[self.class return:value]
             concat:self]
-            setNameWithFormat:@"[%@] -startWith: %@", self.name, [value rac_description]];
+            setNameWithBlock:^{
+                @strongify(self);
+                return [NSString stringWithFormat:@"[%@] -startWith: %@", self.name, [value rac_description]];
+            }];
 }
 
 - (instancetype)skip:(NSUInteger)skipCount {
     Class class = self.class;
 
+    @weakify(self);
+
     return [[self bind:^{
         __block NSUInteger skipped = 0;
 
@@ -164,7 +293,10 @@
             skipped++;
             return class.empty;
         };
-    }] setNameWithFormat:@"[%@] -skip: %lu", self.name, (unsigned long) skipCount];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -skip: %lu", self.name, (unsigned long) skipCount];
+    }];
 }
 
 - (instancetype)take:(NSUInteger)count {
@@ -172,6 +304,8 @@
 
     if (count == 0) return class.empty;
 
+    @weakify(self);
+
     return [[self bind:^{
         __block NSUInteger taken = 0;
 
@@ -180,7 +314,10 @@
 
             return [class return:value];
         };
-    }] setNameWithFormat:@"[%@] -take: %lu", self.name, (unsigned long) count];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -take: %lu", self.name, (unsigned long) count];
+    }];
 }
 
 + (instancetype)join:(id <NSFastEnumeration>)streams block:(RACStream *(^)(id, id))block {
@@ -252,12 +389,17 @@
 - (instancetype)scanWithStart:(id)startingValue reduce:(id (^)(id running, id next))reduceBlock {
     NSCParameterAssert(reduceBlock != nil);
 
+    @weakify(self);
+
     return [[self
             scanWithStart:startingValue
           reduceWithIndex:^(id running, id next, NSUInteger index) {
               return reduceBlock(running, next);
           }]
-            setNameWithFormat:@"[%@] -scanWithStart: %@ reduce:", self.name, [startingValue rac_description]];
+            setNameWithBlock:^{
+                @strongify(self);
+                return [NSString stringWithFormat:@"[%@] -scanWithStart: %@ reduce:", self.name, [startingValue rac_description]];
+            }];
 }
 
 - (instancetype)scanWithStart:(id)startingValue reduceWithIndex:(id (^)(id, id, NSUInteger))reduceBlock {
@@ -265,6 +407,8 @@
 
     Class class = self.class;
 
+    @weakify(self);
+
     return [[self bind:^{
         __block id running = startingValue;
         __block NSUInteger index = 0;
@@ -273,7 +417,10 @@
             running = reduceBlock(running, value, index++);
             return [class return:running];
         };
-    }] setNameWithFormat:@"[%@] -scanWithStart: %@ reduceWithIndex:", self.name, [startingValue rac_description]];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -scanWithStart: %@ reduceWithIndex:", self.name, [startingValue rac_description]];
+    }];
 }
 
 - (instancetype)takeUntilBlock:(BOOL (^)(id x))predicate {
@@ -281,21 +428,31 @@
 
     Class class = self.class;
 
+    @weakify(self);
+
     return [[self bind:^{
         return ^id(id value, BOOL *stop) {
             if (predicate(value)) return nil;
 
             return [class return:value];
         };
-    }] setNameWithFormat:@"[%@] -takeUntilBlock:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -takeUntilBlock:", self.name];
+    }];
 }
 
 - (instancetype)takeWhileBlock:(BOOL (^)(id x))predicate {
     NSCParameterAssert(predicate != nil);
 
+    @weakify(self);
+
     return [[self takeUntilBlock:^BOOL(id x) {
         return !predicate(x);
-    }] setNameWithFormat:@"[%@] -takeWhileBlock:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -takeWhileBlock:", self.name];
+    }];
 }
 
 - (instancetype)skipUntilBlock:(BOOL (^)(id x))predicate {
@@ -303,6 +460,8 @@
 
     Class class = self.class;
 
+    @weakify(self);
+
     return [[self bind:^{
         __block BOOL skipping = YES;
 
@@ -317,20 +476,30 @@
 
             return [class return:value];
         };
-    }] setNameWithFormat:@"[%@] -skipUntilBlock:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -skipUntilBlock:", self.name];
+    }];
 }
 
 - (instancetype)skipWhileBlock:(BOOL (^)(id x))predicate {
     NSCParameterAssert(predicate != nil);
 
+    @weakify(self);
+
     return [[self skipUntilBlock:^BOOL(id x) {
         return !predicate(x);
-    }] setNameWithFormat:@"[%@] -skipWhileBlock:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -skipWhileBlock:", self.name];
+    }];
 }
 
 - (instancetype)distinctUntilChanged {
     Class class = self.class;
 
+    @weakify(self);
+
     return [[self bind:^{
         __block id lastValue = nil;
         __block BOOL initial = YES;
@@ -342,7 +511,10 @@
             lastValue = x;
             return [class return:x];
         };
-    }] setNameWithFormat:@"[%@] -distinctUntilChanged", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -distinctUntilChanged", self.name];
+    }];
 }
 
 @end
@@ -355,9 +527,14 @@
 - (instancetype)sequenceMany:(RACStream *(^)(void))block {
     NSCParameterAssert(block != NULL);
 
+    @weakify(self);
+
     return [[self flattenMap:^(id _) {
         return block();
-    }] setNameWithFormat:@"[%@] -sequenceMany:", self.name];
+    }] setNameWithBlock:^{
+        @strongify(self);
+        return [NSString stringWithFormat:@"[%@] -sequenceMany:", self.name];
+    }];
 }
 
 - (instancetype)scanWithStart:(id)startingValue combine:(id (^)(id running, id next))block {
@@ -18,6 +18,14 @@
 
 @end
 
+// Enumerates the characters of a RACStringSequence by index, without creating
+// any tail sequences.
+@interface RACStringSequenceEnumerator : NSEnumerator
+
+- (id)initWithString:(NSString *)string offset:(NSUInteger)offset;
+
+@end
+
 @implementation RACStringSequence
 
 #pragma mark Lifecycle
@@ -56,6 +64,42 @@
 	return [array copy];
 }
 
+- (NSEnumerator *)objectEnumerator {
+	return [[RACStringSequenceEnumerator alloc] initWithString:self.string offset:self.offset];
+}
+
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id[])stackbuf count:(NSUInteger)len {
+	NSCParameterAssert(len > 0);
+
+	if (state->state >= self.string.length) {
+		// Enumeration has completed.
+		return 0;
+	}
+
+	if (state->state == 0) {
+		state->state = self.offset;
+
+		// Since a sequence doesn't mutate, this just needs to be set to
+		// something non-NULL.
+		state->mutationsPtr = state->extra;
+	}
+
+	state->itemsPtr = stackbuf;
+
+	NSUInteger count = MIN(len, self.string.length - state->state);
+	for (NSUInteger i = 0; i < count; i++) {
+		// Keep each character alive until the caller is done with it, just like
+		// -head.
+		__autoreleasing NSString *character = [self.string substringWithRange:NSMakeRange(state->state + i, 1)];
+		stackbuf[i] = character;
+	}
+
+	state->state += count;
+	return count;
+}
+
 #pragma mark NSObject
 
 - (NSString *)description {
@@ -63,3 +107,33 @@
 }
 
 @end
+
+@implementation RACStringSequenceEnumerator {
+	NSString *_string;
+
+	// The index of the next character to return.
+	NSUInteger _index;
+}
+
+#pragma mark Lifecycle
+
+- (id)initWithString:(NSString *)string offset:(NSUInteger)offset {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_string = string;
+	_index = offset;
+
+	return self;
+}
+
+#pragma mark NSEnumerator
+
+- (id)nextObject {
+	if (_index >= _string.length) return nil;
+
+	return [_string substringWithRange:NSMakeRange(_index++, 1)];
+}
+
+@end
+
@@ -14,6 +14,10 @@
 ///
 /// They're most helpful in bridging the non-RAC world to RAC, since they let you
 /// manually control the sending of events.
+///
+/// Events are sent to an immutable snapshot of the subscribers, without locking
+/// or copying. Subscribing and disposing of a subscription replace that
+/// snapshot, and so take time proportional to the number of subscribers.
 @interface RACSubject : RACSignal <RACSubscriber>
 
 /// Returns a new subject.
@@ -10,17 +10,29 @@
 #import "EXTScope.h"
 #import "RACCompoundDisposable.h"
 #import "RACPassthroughSubscriber.h"
-
-@interface RACSubject ()
-
-// Contains all current subscribers to the receiver.
-//
-// This should only be used while synchronized on `self`.
-@property (nonatomic, strong, readonly) NSMutableArray *subscribers;
+#import <libkern/OSAtomic.h>
+
+@interface RACSubject () {
+	// Protects `_subscribers`.
+	//
+	// This is only held long enough to read or replace the pointer, never while
+	// events are being sent.
+	OSSpinLock _subscribersLock;
+
+	// An immutable snapshot of all current subscribers to the receiver.
+	//
+	// Subscription and disposal replace this array wholesale, so an event can
+	// be sent to a snapshot without copying it. This ivar should only be
+	// accessed while _subscribersLock is held.
+	NSArray *_subscribers;
+}
 
 // Contains all of the receiver's subscriptions to other signals.
 @property (nonatomic, strong, readonly) RACCompoundDisposable *disposable;
 
+// Returns the current snapshot of the receiver's subscribers.
+- (NSArray *)subscribers;
+
 // Enumerates over each of the receiver's `subscribers` and invokes `block` for
 // each.
 - (void)enumerateSubscribersUsingBlock:(void (^)(id<RACSubscriber> subscriber))block;
@@ -40,7 +52,7 @@
 	if (self == nil) return nil;
 
 	_disposable = [RACCompoundDisposable compoundDisposable];
-	_subscribers = [[NSMutableArray alloc] initWithCapacity:1];
+	_subscribers = @[];
 	
 	return self;
 }
@@ -57,31 +69,55 @@
 	RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
 	subscriber = [[RACPassthroughSubscriber alloc] initWithSubscriber:subscriber signal:self disposable:disposable];
 
-	NSMutableArray *subscribers = self.subscribers;
-	@synchronized (subscribers) {
-		[subscribers addObject:subscriber];
-	}
-	
+	OSSpinLockLock(&_subscribersLock);
+	_subscribers = [_subscribers arrayByAddingObject:subscriber];
+	OSSpinLockUnlock(&_subscribersLock);
+
+	@weakify(self);
+
 	return [RACDisposable disposableWithBlock:^{
-		@synchronized (subscribers) {
-			// Since newer subscribers are generally shorter-lived, search
-			// starting from the end of the list.
-			NSUInteger index = [subscribers indexOfObjectWithOptions:NSEnumerationReverse passingTest:^ BOOL (id<RACSubscriber> obj, NSUInteger index, BOOL *stop) {
-				return obj == subscriber;
-			}];
-
-			if (index != NSNotFound) [subscribers removeObjectAtIndex:index];
+		@strongify(self);
+		if (self == nil) return;
+
+		NSArray *previousSubscribers;
+
+		OSSpinLockLock(&self->_subscribersLock);
+		{
+			previousSubscribers = self->_subscribers;
+
+			// Since newer subscribers are generally shorter-lived, the common
+			// case is trimming the end of the list, which doesn't need to
+			// search. Either way, replacing the snapshot copies it, so removal
+			// is O(n) in the number of subscribers.
+			NSUInteger count = previousSubscribers.count;
+			NSUInteger index = (count > 0 && previousSubscribers[count - 1] == subscriber ? count - 1 : [previousSubscribers indexOfObjectIdenticalTo:subscriber]);
+
+			if (index != NSNotFound) {
+				NSMutableArray *subscribers = [previousSubscribers mutableCopy];
+				[subscribers removeObjectAtIndex:index];
+				self->_subscribers = [subscribers copy];
+			}
 		}
+		OSSpinLockUnlock(&self->_subscribersLock);
+
+		// `previousSubscribers` is released here, outside of the lock, in case it
+		// held the last reference to any subscriber.
+		previousSubscribers = nil;
 	}];
 }
 
-- (void)enumerateSubscribersUsingBlock:(void (^)(id<RACSubscriber> subscriber))block {
+- (NSArray *)subscribers {
 	NSArray *subscribers;
-	@synchronized (self.subscribers) {
-		subscribers = [self.subscribers copy];
-	}
 
-	for (id<RACSubscriber> subscriber in subscribers) {
+	OSSpinLockLock(&_subscribersLock);
+	subscribers = _subscribers;
+	OSSpinLockUnlock(&_subscribersLock);
+
+	return subscribers;
+}
+
+- (void)enumerateSubscribersUsingBlock:(void (^)(id<RACSubscriber> subscriber))block {
+	for (id<RACSubscriber> subscriber in self.subscribers) {
 		block(subscriber);
 	}
 }
@@ -89,9 +125,11 @@
 #pragma mark RACSubscriber
 
 - (void)sendNext:(id)value {
-	[self enumerateSubscribersUsingBlock:^(id<RACSubscriber> subscriber) {
+	// Iterated directly, rather than with -enumerateSubscribersUsingBlock:, since
+	// this is the hottest path through a subject.
+	for (id<RACSubscriber> subscriber in self.subscribers) {
 		[subscriber sendNext:value];
-	}];
+	}
 }
 
 - (void)sendError:(NSError *)error {
@@ -14,4 +14,14 @@
 // Creates a new subscriber with the given blocks.
 + (instancetype)subscriberWithNext:(void (^)(id x))next error:(void (^)(NSError *error))error completed:(void (^)(void))completed;
 
+// Creates a new subscriber with the given blocks, which advertises `demand` to
+// the signals it subscribes to.
+//
+// The demand is decremented as each value is received.
++ (instancetype)subscriberWithNext:(void (^)(id x))next error:(void (^)(NSError *error))error completed:(void (^)(void))completed demand:(RACDemand *)demand;
+
+// The demand advertised by this subscriber, or nil if it accepts values as fast
+// as they can be sent.
+@property (nonatomic, strong, readonly) RACDemand *demand;
+
 @end
@@ -9,6 +9,7 @@
 #import <Foundation/Foundation.h>
 
 @class RACCompoundDisposable;
+@class RACDemand;
 
 /// Represents any object which can directly receive values from a RACSignal.
 ///
@@ -48,4 +49,15 @@
 /// subscriptions.
 - (void)didSubscribeWithDisposable:(RACCompoundDisposable *)disposable;
 
+@optional
+
+/// The demand that this subscriber has advertised, or nil if the subscriber
+/// will accept values as fast as they can be sent.
+///
+/// Signals which support backpressure will look this up (using +[RACDemand
+/// demandForSubscriber:]) when subscribed to, and will wait for outstanding
+/// demand before sending each value. Subscribers which don't implement this
+/// method keep receiving values as usual.
+- (RACDemand *)demand;
+
 @end
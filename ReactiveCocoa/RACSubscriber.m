@@ -10,6 +10,7 @@
 #import "RACSubscriber+Private.h"
 #import "EXTScope.h"
 #import "RACCompoundDisposable.h"
+#import "RACDemand.h"
 
 @interface RACSubscriber ()
 
@@ -36,6 +37,13 @@
 	return subscriber;
 }
 
++ (instancetype)subscriberWithNext:(void (^)(id x))next error:(void (^)(NSError *error))error completed:(void (^)(void))completed demand:(RACDemand *)demand {
+	RACSubscriber *subscriber = [self subscriberWithNext:next error:error completed:completed];
+	subscriber->_demand = demand;
+
+	return subscriber;
+}
+
 - (id)init {
 	self = [super init];
 	if (self == nil) return nil;
@@ -65,6 +73,10 @@
 #pragma mark RACSubscriber
 
 - (void)sendNext:(id)value {
+	// Consume demand before invoking the block, so that any -request: made in
+	// response to this value isn't immediately used up.
+	[self.demand decrement];
+
 	@synchronized (self) {
 		void (^nextBlock)(id) = [self.next copy];
 		if (nextBlock == nil) return;
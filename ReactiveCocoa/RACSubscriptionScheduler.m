@@ -46,9 +46,19 @@
 	return [scheduler after:date schedule:block];
 }
 
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	RACScheduler *scheduler = RACScheduler.currentScheduler ?: self.backgroundScheduler;
+	return [scheduler afterNanoseconds:delay schedule:block];
+}
+
 - (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
 	RACScheduler *scheduler = RACScheduler.currentScheduler ?: self.backgroundScheduler;
 	return [scheduler after:date repeatingEvery:interval withLeeway:leeway schedule:block];
 }
 
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	RACScheduler *scheduler = RACScheduler.currentScheduler ?: self.backgroundScheduler;
+	return [scheduler afterNanoseconds:delay repeatingEveryNanoseconds:interval withLeewayNanoseconds:leeway schedule:block];
+}
+
 @end
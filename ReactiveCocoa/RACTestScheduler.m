@@ -14,11 +14,12 @@
 
 @interface RACTestSchedulerAction : NSObject
 
-// The date at which the action should be executed.
+// The time at which the action should be executed, as an interval since the
+// reference date.
 //
-// This absolute time will not actually be honored. This date is only used for
+// This absolute time will not actually be honored. This time is only used for
 // comparison, to determine which block should be run _next_.
-@property (nonatomic, copy, readonly) NSDate *date;
+@property (nonatomic, assign, readonly) NSTimeInterval time;
 
 // The scheduled block.
 @property (nonatomic, copy, readonly) void (^block)(void);
@@ -29,14 +30,17 @@
 @property (nonatomic, strong, readonly) RACDisposable *disposable;
 
 // Initializes a new scheduler action.
-- (id)initWithDate:(NSDate *)date block:(void (^)(void))block;
+- (id)initWithTime:(NSTimeInterval)time block:(void (^)(void))block;
 
 @end
 
 static CFComparisonResult RACCompareScheduledActions(const void *ptr1, const void *ptr2, void *info) {
 	RACTestSchedulerAction *action1 = (__bridge id)ptr1;
 	RACTestSchedulerAction *action2 = (__bridge id)ptr2;
-	return CFDateCompare((__bridge CFDateRef)action1.date, (__bridge CFDateRef)action2.date, NULL);
+	if (action1.time < action2.time) return kCFCompareLessThan;
+	if (action1.time > action2.time) return kCFCompareGreaterThan;
+
+	return kCFCompareEqualTo;
 }
 
 static const void *RACRetainScheduledAction(CFAllocatorRef allocator, const void *ptr) {
@@ -114,16 +118,9 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 
 			if (action.disposable.disposed) continue;
 
-			RACScheduler *previousScheduler = RACScheduler.currentScheduler;
-			NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey] = self;
-
+			RACScheduler *previousScheduler = RACSchedulerExchangeCurrentScheduler(self);
 			action.block();
-
-			if (previousScheduler != nil) {
-				NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey] = previousScheduler;
-			} else {
-				[NSThread.currentThread.threadDictionary removeObjectForKey:RACSchedulerCurrentSchedulerKey];
-			}
+			RACSchedulerExchangeCurrentScheduler(previousScheduler);
 		}
 	}
 }
@@ -138,10 +135,10 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 	NSCParameterAssert(block != nil);
 
 	@synchronized (self) {
-		NSDate *uniqueDate = [NSDate dateWithTimeIntervalSinceReferenceDate:self.numberOfDirectlyScheduledBlocks];
+		NSTimeInterval uniqueTime = self.numberOfDirectlyScheduledBlocks;
 		self.numberOfDirectlyScheduledBlocks++;
 
-		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithDate:uniqueDate block:block];
+		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithTime:uniqueTime block:block];
 		CFBinaryHeapAddValue(self.scheduledActions, (__bridge void *)action);
 
 		return action.disposable;
@@ -152,8 +149,18 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 	NSCParameterAssert(date != nil);
 	NSCParameterAssert(block != nil);
 
+	return [self afterTime:date.timeIntervalSinceReferenceDate schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	NSCParameterAssert(block != nil);
+
+	return [self afterTime:CFAbsoluteTimeGetCurrent() + (NSTimeInterval)delay / NSEC_PER_SEC schedule:block];
+}
+
+- (RACDisposable *)afterTime:(NSTimeInterval)time schedule:(void (^)(void))block {
 	@synchronized (self) {
-		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithDate:date block:block];
+		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithTime:time block:block];
 		CFBinaryHeapAddValue(self.scheduledActions, (__bridge void *)action);
 
 		return action.disposable;
@@ -166,6 +173,17 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 	NSCParameterAssert(interval >= 0);
 	NSCParameterAssert(leeway >= 0);
 
+	return [self afterTime:date.timeIntervalSinceReferenceDate repeatingEvery:interval schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(block != nil);
+
+	NSTimeInterval time = CFAbsoluteTimeGetCurrent() + (NSTimeInterval)delay / NSEC_PER_SEC;
+	return [self afterTime:time repeatingEvery:(NSTimeInterval)interval / NSEC_PER_SEC schedule:block];
+}
+
+- (RACDisposable *)afterTime:(NSTimeInterval)time repeatingEvery:(NSTimeInterval)interval schedule:(void (^)(void))block {
 	RACCompoundDisposable *compoundDisposable = [RACCompoundDisposable compoundDisposable];
 
 	@weakify(self);
@@ -178,13 +196,13 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 			[compoundDisposable removeDisposable:thisDisposable];
 
 			// Schedule the next interval.
-			RACDisposable *schedulingDisposable = [self after:[date dateByAddingTimeInterval:interval] repeatingEvery:interval withLeeway:leeway schedule:block];
+			RACDisposable *schedulingDisposable = [self afterTime:time + interval repeatingEvery:interval schedule:block];
 			[compoundDisposable addDisposable:schedulingDisposable];
 
 			block();
 		};
 
-		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithDate:date block:reschedulingBlock];
+		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithTime:time block:reschedulingBlock];
 		CFBinaryHeapAddValue(self.scheduledActions, (__bridge void *)action);
 
 		thisDisposable = action.disposable;
@@ -200,14 +218,13 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 
 #pragma mark Lifecycle
 
-- (id)initWithDate:(NSDate *)date block:(void (^)(void))block {
-	NSCParameterAssert(date != nil);
+- (id)initWithTime:(NSTimeInterval)time block:(void (^)(void))block {
 	NSCParameterAssert(block != nil);
 
 	self = [super init];
 	if (self == nil) return nil;
 
-	_date = [date copy];
+	_time = time;
 	_block = [block copy];
 	_disposable = [[RACDisposable alloc] init];
 
@@ -217,7 +234,7 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 #pragma mark NSObject
 
 - (NSString *)description {
-	return [NSString stringWithFormat:@"<%@: %p>{ date: %@ }", self.class, self, self.date];
+	return [NSString stringWithFormat:@"<%@: %p>{ date: %@ }", self.class, self, [NSDate dateWithTimeIntervalSinceReferenceDate:self.time]];
 }
 
 @end
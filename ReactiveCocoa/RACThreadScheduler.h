@@ -0,0 +1,30 @@
+//
+//  RACThreadScheduler.h
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACScheduler.h"
+
+/// A serial scheduler which runs its blocks on a dedicated thread.
+///
+/// Unlike RACTargetQueueScheduler, blocks are not submitted to GCD. Instead,
+/// they're added to a lock-free queue which the thread drains in batches, so
+/// a busy scheduler only wakes its thread once for many blocks. This makes it
+/// well-suited to sending large numbers of small events.
+///
+/// Each instance owns a thread until it's deallocated, so these schedulers
+/// should be long-lived, and shared wherever possible.
+@interface RACThreadScheduler : RACScheduler
+
+/// Initializes the receiver and starts its thread.
+///
+/// name - The name of the scheduler, which is also used for its thread. If nil,
+///        a default name will be used.
+///
+/// Returns the initialized object.
+- (id)initWithName:(NSString *)name;
+
+@end
@@ -0,0 +1,389 @@
+//
+//  RACThreadScheduler.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACThreadScheduler.h"
+#import "RACDisposable.h"
+#import "RACQueueScheduler+Subclass.h"
+#import "RACScheduler+Private.h"
+#import <libkern/OSAtomic.h>
+#import <stddef.h>
+
+// The maximum number of blocks to run as one batch, before draining the
+// autorelease pool.
+static const NSUInteger RACThreadSchedulerBatchSize = 128;
+
+// The maximum number of nodes to keep around for reuse.
+static const int32_t RACThreadSchedulerMaximumFreeNodes = 1024;
+
+// An entry in the queue of a RACThreadScheduler.
+typedef struct RACThreadSchedulerNode {
+	// The next node in the queue, or in the list of free nodes.
+	struct RACThreadSchedulerNode * volatile next;
+
+	// The retained block to run.
+	void *block;
+
+	// The retained RACDisposable which cancels the block.
+	void *disposable;
+} RACThreadSchedulerNode;
+
+// Appends `node` to the queue whose most recently enqueued node is `*head`.
+//
+// This may be invoked concurrently from any number of threads.
+static void RACThreadSchedulerPush(RACThreadSchedulerNode * volatile *head, RACThreadSchedulerNode *node) {
+	node->next = NULL;
+
+	RACThreadSchedulerNode *previous;
+	do {
+		previous = *head;
+	} while (!OSAtomicCompareAndSwapPtrBarrier(previous, node, (void * volatile *)head));
+
+	// Until this is set, the queue is briefly disconnected, and the worker will
+	// see it as neither empty nor dequeueable.
+	previous->next = node;
+}
+
+// Owns the queue and thread of a RACThreadScheduler.
+//
+// The thread holds a strong reference to the worker, not the scheduler, so that
+// the scheduler can be deallocated while the thread is idle. While there's work
+// in the queue, the thread keeps the scheduler alive.
+@interface RACThreadSchedulerWorker : NSObject {
+	// A placeholder which is in the queue whenever it's otherwise empty.
+	RACThreadSchedulerNode _stub;
+
+	// The most recently enqueued node.
+	RACThreadSchedulerNode * volatile _head;
+
+	// The next node to dequeue. This is only used by the thread.
+	RACThreadSchedulerNode *_tail;
+
+	// Nodes which have already been run, and can be reused.
+	OSQueueHead _freeNodes;
+	volatile int32_t _freeNodeCount;
+
+	// Whether the thread is waiting (or about to wait) on `_semaphore`.
+	//
+	// Whoever changes this from 1 to 0 is responsible for waking up the thread.
+	volatile int32_t _sleeping;
+
+	dispatch_semaphore_t _semaphore;
+
+	// A retained scheduler handed to the thread when it's woken up, or NULL if
+	// the thread was woken because the scheduler was deallocated.
+	void *_wakingScheduler;
+}
+
+// Enqueues a block, and wakes up the thread if necessary.
+//
+// This may be invoked from any thread.
+//
+// block      - The block to run. This must not be nil.
+// disposable - A disposable which, if disposed before the block runs, will
+//              cancel it. This must not be nil.
+// scheduler  - The scheduler to run the block on. This must not be nil.
+- (void)enqueueBlock:(void (^)(void))block disposable:(RACDisposable *)disposable scheduler:(RACThreadScheduler *)scheduler;
+
+// Tells the thread to exit once it's idle.
+- (void)schedulerDidDeallocate;
+
+// The body of the thread.
+- (void)run;
+
+@end
+
+@interface RACThreadScheduler ()
+
+@property (nonatomic, strong, readonly) RACThreadSchedulerWorker *worker;
+
+@end
+
+@implementation RACThreadScheduler
+
+#pragma mark Lifecycle
+
+- (id)init {
+	return [self initWithName:nil];
+}
+
+- (id)initWithName:(NSString *)name {
+	self = [super initWithName:name];
+	if (self == nil) return nil;
+
+	_worker = [[RACThreadSchedulerWorker alloc] init];
+
+	NSThread *thread = [[NSThread alloc] initWithTarget:_worker selector:@selector(run) object:nil];
+	thread.name = name ?: @"com.ReactiveCocoa.RACThreadScheduler";
+	[thread start];
+
+	return self;
+}
+
+- (void)dealloc {
+	[_worker schedulerDidDeallocate];
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	NSCParameterAssert(block != NULL);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+	[self.worker enqueueBlock:block disposable:disposable scheduler:self];
+
+	return disposable;
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[RACQueueScheduler wallTimeWithDate:date] schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[RACQueueScheduler timeWithNanoseconds:delay] schedule:block];
+}
+
+- (RACDisposable *)afterTime:(dispatch_time_t)when schedule:(void (^)(void))block {
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+
+	// Wait on GCD, since the thread can't sleep while it has other work to do.
+	dispatch_after(when, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+		if (disposable.disposed) return;
+		[self.worker enqueueBlock:block disposable:disposable scheduler:self];
+	});
+
+	return disposable;
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(interval > 0.0 && interval < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(leeway >= 0.0 && leeway < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(block != NULL);
+
+	uint64_t intervalInNanoSecs = (uint64_t)(interval * NSEC_PER_SEC);
+	uint64_t leewayInNanoSecs = (uint64_t)(leeway * NSEC_PER_SEC);
+
+	return [self afterTime:[RACQueueScheduler wallTimeWithDate:date] repeatingEvery:intervalInNanoSecs withLeeway:leewayInNanoSecs schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(interval > 0);
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[RACQueueScheduler timeWithNanoseconds:delay] repeatingEvery:interval withLeeway:leeway schedule:block];
+}
+
+- (RACDisposable *)afterTime:(dispatch_time_t)when repeatingEvery:(uint64_t)interval withLeeway:(uint64_t)leeway schedule:(void (^)(void))block {
+	dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0));
+	dispatch_source_set_timer(timer, when, interval, leeway);
+
+	// Shared by every enqueued block, so that disposal also cancels any which
+	// haven't run yet.
+	RACDisposable *disposable = [RACDisposable disposableWithBlock:^{
+		dispatch_source_cancel(timer);
+	}];
+
+	dispatch_source_set_event_handler(timer, ^{
+		[self.worker enqueueBlock:block disposable:disposable scheduler:self];
+	});
+
+	dispatch_resume(timer);
+
+	return disposable;
+}
+
+@end
+
+@implementation RACThreadSchedulerWorker
+
+#pragma mark Lifecycle
+
+- (id)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_head = &_stub;
+	_tail = &_stub;
+	_freeNodes = (OSQueueHead)OS_ATOMIC_QUEUE_INIT;
+
+	// The thread starts out waiting for work.
+	_sleeping = 1;
+	_semaphore = dispatch_semaphore_create(0);
+
+	return self;
+}
+
+- (void)dealloc {
+	// The thread has exited by now, so there are no other users of the queue.
+	RACThreadSchedulerNode *node;
+	while ((node = [self dequeueNode]) != NULL) {
+		CFRelease(node->block);
+		CFRelease(node->disposable);
+		free(node);
+	}
+
+	while ((node = OSAtomicDequeue(&_freeNodes, offsetof(RACThreadSchedulerNode, next))) != NULL) {
+		free(node);
+	}
+
+#if !OS_OBJECT_HAVE_OBJC_SUPPORT
+	dispatch_release(_semaphore);
+#endif
+}
+
+#pragma mark Queue
+
+- (void)enqueueBlock:(void (^)(void))block disposable:(RACDisposable *)disposable scheduler:(RACThreadScheduler *)scheduler {
+	NSCParameterAssert(block != nil);
+	NSCParameterAssert(disposable != nil);
+	NSCParameterAssert(scheduler != nil);
+
+	RACThreadSchedulerNode *node = OSAtomicDequeue(&_freeNodes, offsetof(RACThreadSchedulerNode, next));
+	if (node != NULL) {
+		OSAtomicDecrement32(&_freeNodeCount);
+	} else {
+		node = malloc(sizeof(*node));
+	}
+
+	node->block = (void *)CFBridgingRetain([block copy]);
+	node->disposable = (void *)CFBridgingRetain(disposable);
+
+	RACThreadSchedulerPush(&_head, node);
+
+	if (OSAtomicCompareAndSwap32Barrier(1, 0, &_sleeping)) {
+		_wakingScheduler = (void *)CFBridgingRetain(scheduler);
+		dispatch_semaphore_signal(_semaphore);
+	}
+}
+
+// Removes the oldest node from the queue.
+//
+// This must only be invoked from the thread.
+//
+// Returns the node, or NULL if the queue is empty (or a node is still being
+// enqueued).
+- (RACThreadSchedulerNode *)dequeueNode {
+	RACThreadSchedulerNode *tail = _tail;
+	RACThreadSchedulerNode *next = tail->next;
+
+	if (tail == &_stub) {
+		if (next == NULL) return NULL;
+
+		_tail = next;
+		tail = next;
+		next = next->next;
+	}
+
+	if (next == NULL) {
+		// `tail` is the last node, unless another one is partway through being
+		// enqueued. Put the stub back behind it, so `tail` can be removed.
+		if (tail != _head) return NULL;
+
+		RACThreadSchedulerPush(&_head, &_stub);
+
+		next = tail->next;
+		if (next == NULL) return NULL;
+	}
+
+	_tail = next;
+
+	// Make sure the node's contents are visible before they're read.
+	OSMemoryBarrier();
+
+	return tail;
+}
+
+// Whether the queue has nothing in it, or partway through being enqueued.
+//
+// This must only be invoked from the thread.
+- (BOOL)isEmpty {
+	return _tail == &_stub && _head == &_stub;
+}
+
+// Returns a node to the list of free nodes, or frees it if there are already
+// enough.
+- (void)recycleNode:(RACThreadSchedulerNode *)node {
+	if (_freeNodeCount >= RACThreadSchedulerMaximumFreeNodes) {
+		free(node);
+		return;
+	}
+
+	OSAtomicIncrement32(&_freeNodeCount);
+	OSAtomicEnqueue(&_freeNodes, node, offsetof(RACThreadSchedulerNode, next));
+}
+
+#pragma mark Thread
+
+- (void)run {
+	@autoreleasepool {
+		RACThreadScheduler *scheduler = nil;
+
+		while (YES) {
+			if (scheduler == nil) {
+				dispatch_semaphore_wait(_semaphore, DISPATCH_TIME_FOREVER);
+
+				scheduler = CFBridgingRelease(_wakingScheduler);
+				_wakingScheduler = NULL;
+
+				// We were woken up by -schedulerDidDeallocate.
+				if (scheduler == nil) break;
+			}
+
+			if ([self runBatchOnScheduler:scheduler]) continue;
+
+			// The queue looks empty, so announce that we're going to sleep, then
+			// check again, in case anything was enqueued before the announcement
+			// was visible.
+			OSAtomicCompareAndSwap32Barrier(0, 1, &_sleeping);
+			if (![self isEmpty] && OSAtomicCompareAndSwap32Barrier(1, 0, &_sleeping)) continue;
+
+			// Don't keep the scheduler alive while waiting. If this was the last
+			// reference, -schedulerDidDeallocate will wake us up to exit.
+			scheduler = nil;
+		}
+	}
+}
+
+- (void)schedulerDidDeallocate {
+	if (OSAtomicCompareAndSwap32Barrier(1, 0, &_sleeping)) {
+		_wakingScheduler = NULL;
+		dispatch_semaphore_signal(_semaphore);
+	}
+}
+
+// Runs up to RACThreadSchedulerBatchSize blocks from the queue.
+//
+// Returns whether any blocks were dequeued.
+- (BOOL)runBatchOnScheduler:(RACThreadScheduler *)scheduler {
+	RACThreadSchedulerNode *firstNode = [self dequeueNode];
+	if (firstNode == NULL) return NO;
+
+	// Set up the current scheduler once for the whole batch, rather than for
+	// each block.
+	[scheduler performAsCurrentScheduler:^{
+		RACThreadSchedulerNode *node = firstNode;
+		NSUInteger count = 0;
+
+		do {
+			void (^block)(void) = CFBridgingRelease(node->block);
+			RACDisposable *disposable = CFBridgingRelease(node->disposable);
+			[self recycleNode:node];
+
+			if (!disposable.disposed) block();
+		} while (++count < RACThreadSchedulerBatchSize && (node = [self dequeueNode]) != NULL);
+	}];
+
+	return YES;
+}
+
+@end
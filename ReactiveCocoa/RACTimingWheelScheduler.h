@@ -0,0 +1,50 @@
+//
+//  RACTimingWheelScheduler.h
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACTargetQueueScheduler.h"
+
+/// A scheduler which keeps its future blocks in a hierarchical timing wheel,
+/// instead of creating a GCD timer for each one.
+///
+/// Scheduling and cancelling a future block take constant time, and the
+/// receiver only runs a single timer, which ticks while any future blocks are
+/// pending. Blocks which come due on the same tick are run together, so this is
+/// well suited to large numbers of timeouts and throttles which are usually
+/// cancelled before they fire. Pass it to -timeout:onScheduler:, or deliver
+/// events on it before operators like -throttle: and -delay:, which schedule on
+/// the current scheduler.
+///
+/// Deadlines are measured on a monotonic clock, at the time that a block is
+/// scheduled, so changes to the system clock don't affect when blocks run.
+/// Blocks may run up to one tick late.
+@interface RACTimingWheelScheduler : RACTargetQueueScheduler
+
+/// The interval between ticks of the wheel.
+@property (nonatomic, assign, readonly) NSTimeInterval resolution;
+
+/// Initializes the receiver with a resolution of 10 milliseconds.
+///
+/// name        - The name of the scheduler. If nil, a default name will be used.
+/// targetQueue - The queue to target. Cannot be NULL.
+///
+/// Returns the initialized object.
+- (id)initWithName:(NSString *)name targetQueue:(dispatch_queue_t)targetQueue;
+
+/// Initializes the receiver with a serial queue that will target the given
+/// `targetQueue`.
+///
+/// name        - The name of the scheduler. If nil, a default name will be used.
+/// targetQueue - The queue to target. Cannot be NULL.
+/// resolution  - The interval between ticks of the wheel, which is the
+///               granularity at which future blocks are run. This must be
+///               greater than zero.
+///
+/// Returns the initialized object.
+- (id)initWithName:(NSString *)name targetQueue:(dispatch_queue_t)targetQueue resolution:(NSTimeInterval)resolution;
+
+@end
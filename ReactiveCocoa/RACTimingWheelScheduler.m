@@ -0,0 +1,431 @@
+//
+//  RACTimingWheelScheduler.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACTimingWheelScheduler.h"
+#import "EXTScope.h"
+#import "RACDisposable.h"
+#import "RACQueueScheduler+Subclass.h"
+#import "RACScheduler+Private.h"
+#import <libkern/OSAtomic.h>
+
+// The number of levels in the wheel. Each level covers 256 times the span of
+// the level below it.
+#define RACTimingWheelLevelCount 4
+
+// The number of slots in each level, and the number of bits of a tick that
+// each level covers.
+#define RACTimingWheelSlotCount 256
+#define RACTimingWheelSlotBits 8
+
+@class RACTimingWheelScheduler;
+
+// A block waiting in the wheel, which removes itself when disposed.
+@interface RACTimingWheelEntry : RACDisposable {
+@public
+	// The tick on which the block should run.
+	uint64_t _deadlineTick;
+
+	// The number of ticks between repetitions, or 0 if the block only runs
+	// once.
+	uint64_t _intervalTicks;
+
+	// The position of the entry in the wheel. These are only valid while
+	// `_inWheel` is YES, and should only be used while the wheel's lock is
+	// held.
+	BOOL _inWheel;
+	NSUInteger _level;
+	NSUInteger _slot;
+
+	// The neighbors of the entry in its slot. The first entry of a slot
+	// points back to the last, so that entries can be appended in constant
+	// time.
+	__unsafe_unretained RACTimingWheelEntry *_next;
+	__unsafe_unretained RACTimingWheelEntry *_previous;
+}
+
+@property (nonatomic, strong, readonly) RACTimingWheelScheduler *scheduler;
+@property (nonatomic, copy, readonly) void (^block)(void);
+
+- (id)initWithScheduler:(RACTimingWheelScheduler *)scheduler block:(void (^)(void))block;
+
+@end
+
+@interface RACTimingWheelScheduler () {
+	// Guards all of the wheel state below.
+	OSSpinLock _lock;
+
+	// The first entry in each slot of each level. Entries in the wheel are
+	// retained manually, since they're linked through unretained pointers.
+	__unsafe_unretained RACTimingWheelEntry *_slots[RACTimingWheelLevelCount][RACTimingWheelSlotCount];
+
+	// The number of entries in the wheel.
+	NSUInteger _entryCount;
+
+	// The last tick which has been processed.
+	uint64_t _currentTick;
+
+	// The monotonic time, in nanoseconds, of tick 0.
+	uint64_t _startTime;
+
+	// The length of a tick, in nanoseconds.
+	uint64_t _tickLength;
+
+	// Whether `_timer` is currently firing.
+	BOOL _timerArmed;
+
+#if OS_OBJECT_HAVE_OBJC_SUPPORT
+	dispatch_source_t _timer;
+#else
+	__unsafe_unretained dispatch_source_t _timer;
+#endif
+}
+
+// Removes the given entry from the wheel, if it's still there.
+- (void)removeEntry:(RACTimingWheelEntry *)entry;
+
+@end
+
+@implementation RACTimingWheelScheduler
+
+#pragma mark Lifecycle
+
+- (id)initWithName:(NSString *)name targetQueue:(dispatch_queue_t)targetQueue {
+	return [self initWithName:name targetQueue:targetQueue resolution:0.01];
+}
+
+- (id)initWithName:(NSString *)name targetQueue:(dispatch_queue_t)targetQueue resolution:(NSTimeInterval)resolution {
+	NSCParameterAssert(targetQueue != NULL);
+	NSCParameterAssert(resolution > 0.0 && resolution < INT64_MAX / NSEC_PER_SEC);
+
+	if (name == nil) {
+		name = [NSString stringWithFormat:@"com.ReactiveCocoa.RACTimingWheelScheduler(%s)", dispatch_queue_get_label(targetQueue)];
+	}
+
+	self = [super initWithName:name targetQueue:targetQueue];
+	if (self == nil) return nil;
+
+	_resolution = resolution;
+	_lock = OS_SPINLOCK_INIT;
+	_tickLength = MAX((uint64_t)(resolution * NSEC_PER_SEC), 1);
+	_startTime = RACSchedulerMonotonicTime();
+
+	_timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.queue);
+	dispatch_source_set_timer(_timer, DISPATCH_TIME_FOREVER, _tickLength, 0);
+
+	@weakify(self);
+	dispatch_source_set_event_handler(_timer, ^{
+		@strongify(self);
+		[self tick];
+	});
+
+	dispatch_resume(_timer);
+
+	return self;
+}
+
+- (void)dealloc {
+	// Entries retain the scheduler, so the wheel is empty by now.
+	dispatch_source_cancel(_timer);
+
+#if !OS_OBJECT_HAVE_OBJC_SUPPORT
+	dispatch_release(_timer);
+#endif
+}
+
+#pragma mark Wheel
+
+// Converts a monotonic time into the first tick at or after it.
+- (uint64_t)tickForTime:(uint64_t)time {
+	if (time <= _startTime) return 0;
+
+	uint64_t elapsed = time - _startTime;
+	return elapsed / _tickLength + (elapsed % _tickLength > 0 ? 1 : 0);
+}
+
+// Converts a date into a monotonic time, relative to the current time.
++ (uint64_t)monotonicTimeWithDate:(NSDate *)date {
+	uint64_t now = RACSchedulerMonotonicTime();
+
+	NSTimeInterval interval = date.timeIntervalSinceNow;
+	if (interval <= 0) return now;
+	if (interval >= (double)(UINT64_MAX - now) / NSEC_PER_SEC) return UINT64_MAX;
+
+	return now + (uint64_t)(interval * NSEC_PER_SEC);
+}
+
+// Converts a delay from now into a monotonic time.
++ (uint64_t)monotonicTimeWithDelay:(uint64_t)delay {
+	uint64_t now = RACSchedulerMonotonicTime();
+	if (delay >= UINT64_MAX - now) return UINT64_MAX;
+
+	return now + delay;
+}
+
+// Links the given entry into the slot which covers its deadline.
+//
+// This must be invoked while `_lock` is held.
+- (void)linkEntry:(RACTimingWheelEntry *)entry {
+	uint64_t deadline = MAX(entry->_deadlineTick, _currentTick);
+
+	// Find the lowest level whose current span contains the deadline.
+	NSUInteger level = 0;
+	while (level < RACTimingWheelLevelCount) {
+		NSUInteger parentShift = RACTimingWheelSlotBits * (level + 1);
+		if ((deadline >> parentShift) == (_currentTick >> parentShift)) break;
+
+		level++;
+	}
+
+	NSUInteger slot;
+	if (level < RACTimingWheelLevelCount) {
+		slot = (deadline >> (RACTimingWheelSlotBits * level)) & (RACTimingWheelSlotCount - 1);
+	} else {
+		// The deadline is beyond the span of the wheel, so park the entry in
+		// the top level slot which will be reached last. It'll be relinked
+		// closer to its deadline when that slot cascades.
+		level = RACTimingWheelLevelCount - 1;
+		slot = ((_currentTick >> (RACTimingWheelSlotBits * level)) + RACTimingWheelSlotCount - 1) & (RACTimingWheelSlotCount - 1);
+	}
+
+	entry->_inWheel = YES;
+	entry->_level = level;
+	entry->_slot = slot;
+	entry->_next = nil;
+
+	RACTimingWheelEntry *head = _slots[level][slot];
+	if (head == nil) {
+		entry->_previous = entry;
+		_slots[level][slot] = entry;
+	} else {
+		RACTimingWheelEntry *tail = head->_previous;
+		tail->_next = entry;
+		entry->_previous = tail;
+		head->_previous = entry;
+	}
+}
+
+// Unlinks the given entry from its slot.
+//
+// This must be invoked while `_lock` is held.
+- (void)unlinkEntry:(RACTimingWheelEntry *)entry {
+	RACTimingWheelEntry *head = _slots[entry->_level][entry->_slot];
+
+	if (entry == head) {
+		_slots[entry->_level][entry->_slot] = entry->_next;
+		if (entry->_next != nil) entry->_next->_previous = entry->_previous;
+	} else {
+		entry->_previous->_next = entry->_next;
+
+		if (entry->_next != nil) {
+			entry->_next->_previous = entry->_previous;
+		} else {
+			head->_previous = entry->_previous;
+		}
+	}
+
+	entry->_inWheel = NO;
+	entry->_next = nil;
+	entry->_previous = nil;
+}
+
+// Starts or stops the timer, depending on whether the wheel has any entries.
+//
+// This must be invoked while `_lock` is held.
+- (void)updateTimer {
+	BOOL shouldArm = _entryCount > 0;
+	if (shouldArm == _timerArmed) return;
+
+	_timerArmed = shouldArm;
+
+	if (shouldArm) {
+		dispatch_source_set_timer(_timer, dispatch_time(DISPATCH_TIME_NOW, (int64_t)_tickLength), _tickLength, _tickLength / 10);
+	} else {
+		dispatch_source_set_timer(_timer, DISPATCH_TIME_FOREVER, _tickLength, 0);
+	}
+}
+
+- (void)insertEntry:(RACTimingWheelEntry *)entry deadlineTick:(uint64_t)deadlineTick {
+	OSSpinLockLock(&_lock);
+
+	if (!entry.disposed && !entry->_inWheel) {
+		// The timer doesn't run while the wheel is empty, so catch up to the
+		// present before linking the entry. Otherwise, the next tick would
+		// have to walk through every tick since the wheel went idle.
+		if (_entryCount == 0) {
+			uint64_t nowTick = [self tickForTime:RACSchedulerMonotonicTime()];
+			if (nowTick > _currentTick) _currentTick = nowTick;
+		}
+
+		// Entries never run on the tick that's currently being processed.
+		entry->_deadlineTick = MAX(deadlineTick, _currentTick + 1);
+
+		CFBridgingRetain(entry);
+		[self linkEntry:entry];
+
+		_entryCount++;
+		[self updateTimer];
+	}
+
+	OSSpinLockUnlock(&_lock);
+}
+
+- (void)removeEntry:(RACTimingWheelEntry *)entry {
+	OSSpinLockLock(&_lock);
+
+	BOOL removed = entry->_inWheel;
+	if (removed) {
+		[self unlinkEntry:entry];
+
+		_entryCount--;
+		[self updateTimer];
+	}
+
+	OSSpinLockUnlock(&_lock);
+
+	if (removed) CFBridgingRelease((__bridge CFTypeRef)entry);
+}
+
+// Advances the wheel up to the current time, and runs every entry which has
+// come due.
+- (void)tick {
+	uint64_t targetTick = [self tickForTime:RACSchedulerMonotonicTime()];
+	NSMutableArray *expiredEntries = nil;
+
+	OSSpinLockLock(&_lock);
+
+	// If the wheel is empty, there's nothing to catch up on.
+	if (_entryCount == 0 && targetTick > _currentTick) _currentTick = targetTick;
+
+	while (_currentTick < targetTick) {
+		_currentTick++;
+
+		// Whenever a level wraps around, move the entries in the next slot of
+		// the level above it down into the lower levels. Cascade from the top,
+		// so entries can fall through several levels on the same tick.
+		for (NSUInteger level = RACTimingWheelLevelCount - 1; level > 0; level--) {
+			NSUInteger shift = RACTimingWheelSlotBits * level;
+			if ((_currentTick & ((1ULL << shift) - 1)) != 0) continue;
+
+			NSUInteger slot = (_currentTick >> shift) & (RACTimingWheelSlotCount - 1);
+			RACTimingWheelEntry *entry = _slots[level][slot];
+			_slots[level][slot] = nil;
+
+			while (entry != nil) {
+				RACTimingWheelEntry *next = entry->_next;
+				[self linkEntry:entry];
+				entry = next;
+			}
+		}
+
+		NSUInteger slot = _currentTick & (RACTimingWheelSlotCount - 1);
+		RACTimingWheelEntry *entry = _slots[0][slot];
+		_slots[0][slot] = nil;
+
+		while (entry != nil) {
+			RACTimingWheelEntry *next = entry->_next;
+
+			entry->_inWheel = NO;
+			entry->_next = nil;
+			entry->_previous = nil;
+			_entryCount--;
+
+			if (expiredEntries == nil) expiredEntries = [NSMutableArray array];
+			[expiredEntries addObject:CFBridgingRelease((__bridge CFTypeRef)entry)];
+
+			entry = next;
+		}
+	}
+
+	[self updateTimer];
+	OSSpinLockUnlock(&_lock);
+
+	if (expiredEntries == nil) return;
+
+	[self performAsCurrentScheduler:^{
+		for (RACTimingWheelEntry *entry in expiredEntries) {
+			if (entry.disposed) continue;
+
+			entry.block();
+
+			if (entry->_intervalTicks > 0) {
+				// Skip any repetitions that were missed, rather than running
+				// them all at once.
+				[self insertEntry:entry deadlineTick:entry->_deadlineTick + entry->_intervalTicks];
+			}
+		}
+	}];
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[self.class monotonicTimeWithDate:date] repeatingEvery:0 schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[self.class monotonicTimeWithDelay:delay] repeatingEvery:0 schedule:block];
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(interval > 0.0 && interval < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(leeway >= 0.0 && leeway < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[self.class monotonicTimeWithDate:date] repeatingEvery:(uint64_t)(interval * NSEC_PER_SEC) schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(interval > 0);
+	NSCParameterAssert(block != NULL);
+
+	return [self afterTime:[self.class monotonicTimeWithDelay:delay] repeatingEvery:interval schedule:block];
+}
+
+// Adds a block to the wheel.
+//
+// time     - The monotonic time at which the block should first run.
+// interval - The number of nanoseconds between repetitions, or 0 if the block
+//            should only run once.
+// block    - The block to run.
+- (RACDisposable *)afterTime:(uint64_t)time repeatingEvery:(uint64_t)interval schedule:(void (^)(void))block {
+	RACTimingWheelEntry *entry = [[RACTimingWheelEntry alloc] initWithScheduler:self block:block];
+
+	if (interval > 0) entry->_intervalTicks = MAX(interval / _tickLength, 1);
+
+	[self insertEntry:entry deadlineTick:[self tickForTime:time]];
+	return entry;
+}
+
+@end
+
+@implementation RACTimingWheelEntry
+
+- (id)initWithScheduler:(RACTimingWheelScheduler *)scheduler block:(void (^)(void))block {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_scheduler = scheduler;
+	_block = [block copy];
+
+	return self;
+}
+
+- (void)dispose {
+	// Mark the entry as disposed first, so a repeating entry which is running
+	// concurrently won't be reinserted after it's removed.
+	[super dispose];
+	[self.scheduler removeEntry:self];
+}
+
+@end
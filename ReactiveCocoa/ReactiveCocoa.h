@@ -38,11 +38,14 @@ FOUNDATION_EXPORT const unsigned char ReactiveCocoaVersionString[];
 #import <ReactiveCocoa/RACChannel.h>
 #import <ReactiveCocoa/RACCommand.h>
 #import <ReactiveCocoa/RACCompoundDisposable.h>
+#import <ReactiveCocoa/RACDemand.h>
 #import <ReactiveCocoa/RACDisposable.h>
 #import <ReactiveCocoa/RACEvent.h>
 #import <ReactiveCocoa/RACGroupedSignal.h>
 #import <ReactiveCocoa/RACKVOChannel.h>
+#import <ReactiveCocoa/RACMetrics.h>
 #import <ReactiveCocoa/RACMulticastConnection.h>
+#import <ReactiveCocoa/RACParallelScheduler.h>
 #import <ReactiveCocoa/RACQueueScheduler.h>
 #import <ReactiveCocoa/RACQueueScheduler+Subclass.h>
 #import <ReactiveCocoa/RACReplaySubject.h>
@@ -59,6 +62,8 @@ FOUNDATION_EXPORT const unsigned char ReactiveCocoaVersionString[];
 #import <ReactiveCocoa/RACSubscriptingAssignmentTrampoline.h>
 #import <ReactiveCocoa/RACTargetQueueScheduler.h>
 #import <ReactiveCocoa/RACTestScheduler.h>
+#import <ReactiveCocoa/RACThreadScheduler.h>
+#import <ReactiveCocoa/RACTimingWheelScheduler.h>
 #import <ReactiveCocoa/RACTuple.h>
 #import <ReactiveCocoa/RACUnit.h>
 
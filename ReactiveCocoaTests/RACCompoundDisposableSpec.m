@@ -109,4 +109,47 @@ qck_it(@"should allow disposables to be removed", ^{
 	expect(@(d.disposed)).to(beFalsy());
 });
 
+qck_it(@"should only dispose of remaining disposables after many removals", ^{
+	RACCompoundDisposable *disposable = [[RACCompoundDisposable alloc] init];
+
+	NSMutableArray *disposables = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 100; i++) {
+		RACDisposable *d = [[RACDisposable alloc] init];
+		[disposables addObject:d];
+		[disposable addDisposable:d];
+	}
+
+	// Remove every disposable but each tenth one, out of order, to exercise
+	// both trimming and compaction.
+	for (NSUInteger i = 0; i < disposables.count; i += 2) {
+		if (i % 10 != 0) [disposable removeDisposable:disposables[i]];
+	}
+
+	for (NSUInteger i = disposables.count; i > 0; i -= 2) {
+		[disposable removeDisposable:disposables[i - 1]];
+	}
+
+	[disposable dispose];
+
+	[disposables enumerateObjectsUsingBlock:^(RACDisposable *d, NSUInteger index, BOOL *stop) {
+		expect(@(d.disposed)).to(equal(@(index % 10 == 0)));
+	}];
+});
+
+qck_it(@"should dispose of a disposable added more than once", ^{
+	RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposableWithDisposables:@[ [[RACDisposable alloc] init], [[RACDisposable alloc] init] ]];
+
+	__block NSUInteger disposeCount = 0;
+	RACDisposable *d = [RACDisposable disposableWithBlock:^{
+		disposeCount++;
+	}];
+
+	[disposable addDisposable:d];
+	[disposable addDisposable:d];
+	expect(@(disposeCount)).to(equal(@0));
+
+	[disposable dispose];
+	expect(@(disposeCount)).to(equal(@1));
+});
+
 QuickSpecEnd
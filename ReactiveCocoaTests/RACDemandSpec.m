@@ -0,0 +1,237 @@
+//
+//  RACDemandSpec.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Quick/Quick.h>
+#import <Nimble/Nimble.h>
+
+#import "NSArray+RACSequenceAdditions.h"
+#import "RACDemand.h"
+#import "RACDisposable.h"
+#import "RACScheduler.h"
+#import "RACSequence.h"
+#import "RACSignal+Operations.h"
+#import "RACSubject.h"
+
+QuickSpecBegin(RACDemandSpec)
+
+__block RACDemand *demand;
+
+qck_beforeEach(^{
+	demand = [[RACDemand alloc] init];
+});
+
+qck_it(@"should start without any outstanding demand", ^{
+	expect(@(demand.outstandingCount)).to(equal(@0));
+});
+
+qck_it(@"should accumulate requests and decrements", ^{
+	[demand request:2];
+	[demand request:3];
+	expect(@(demand.outstandingCount)).to(equal(@5));
+
+	[demand decrement];
+	expect(@(demand.outstandingCount)).to(equal(@4));
+});
+
+qck_it(@"should not decrement below zero", ^{
+	[demand decrement];
+	expect(@(demand.outstandingCount)).to(equal(@0));
+});
+
+qck_it(@"should saturate at unbounded demand", ^{
+	[demand request:NSUIntegerMax];
+	[demand request:1];
+	[demand decrement];
+
+	expect(@(demand.outstandingCount)).to(equal(@(NSUIntegerMax)));
+});
+
+qck_it(@"should perform a block immediately if demand is outstanding", ^{
+	[demand request:1];
+
+	__block BOOL performed = NO;
+	[demand performWhenRequested:^{
+		performed = YES;
+	}];
+
+	expect(@(performed)).to(beTruthy());
+});
+
+qck_it(@"should perform a block once demand is requested", ^{
+	__block NSUInteger performedCount = 0;
+	[demand performWhenRequested:^{
+		performedCount++;
+	}];
+
+	expect(@(performedCount)).to(equal(@0));
+
+	[demand request:1];
+	expect(@(performedCount)).to(equal(@1));
+
+	[demand request:1];
+	expect(@(performedCount)).to(equal(@1));
+});
+
+qck_it(@"should not perform a block after being disposed", ^{
+	__block BOOL performed = NO;
+	RACDisposable *disposable = [demand performWhenRequested:^{
+		performed = YES;
+	}];
+
+	[disposable dispose];
+	[demand request:1];
+
+	expect(@(performed)).to(beFalsy());
+});
+
+qck_describe(@"-[RACSequence signalWithScheduler:]", ^{
+	__block RACSignal *signal;
+
+	qck_beforeEach(^{
+		signal = [@[ @1, @2, @3, @4 ].rac_sequence signalWithScheduler:RACScheduler.immediateScheduler];
+	});
+
+	qck_it(@"should only send requested values", ^{
+		NSMutableArray *values = [NSMutableArray array];
+		__block BOOL completed = NO;
+
+		[signal subscribeNext:^(id x) {
+			[values addObject:x];
+		} error:nil completed:^{
+			completed = YES;
+		} demand:demand];
+
+		expect(values).to(equal(@[]));
+
+		[demand request:1];
+		expect(values).to(equal(@[ @1 ]));
+
+		[demand request:2];
+		expect(values).to(equal(@[ @1, @2, @3 ]));
+		expect(@(completed)).to(beFalsy());
+
+		[demand request:5];
+		expect(values).to(equal(@[ @1, @2, @3, @4 ]));
+		expect(@(completed)).to(beTruthy());
+	});
+
+	qck_it(@"should stop waiting for demand when disposed", ^{
+		NSMutableArray *values = [NSMutableArray array];
+
+		RACDisposable *disposable = [signal subscribeNext:^(id x) {
+			[values addObject:x];
+		} error:nil completed:nil demand:demand];
+
+		[disposable dispose];
+		[demand request:1];
+
+		expect(values).to(equal(@[]));
+	});
+
+	qck_it(@"should send values as usual to subscribers without demand", ^{
+		expect([signal toArray]).to(equal(@[ @1, @2, @3, @4 ]));
+	});
+});
+
+qck_describe(@"-[RACSequence signalWithScheduler:batchSize:]", ^{
+	qck_it(@"should only send requested values", ^{
+		RACSignal *signal = [@[ @1, @2, @3, @4 ].rac_sequence signalWithScheduler:RACScheduler.immediateScheduler batchSize:10];
+
+		NSMutableArray *values = [NSMutableArray array];
+		__block BOOL completed = NO;
+
+		[signal subscribeNext:^(id x) {
+			[values addObject:x];
+		} error:nil completed:^{
+			completed = YES;
+		} demand:demand];
+
+		expect(values).to(equal(@[]));
+
+		[demand request:1];
+		expect(values).to(equal(@[ @1 ]));
+
+		[demand request:2];
+		expect(values).to(equal(@[ @1, @2, @3 ]));
+		expect(@(completed)).to(beFalsy());
+
+		[demand request:5];
+		expect(values).to(equal(@[ @1, @2, @3, @4 ]));
+		expect(@(completed)).to(beTruthy());
+	});
+});
+
+qck_describe(@"-flatten:", ^{
+	qck_it(@"should only request as many signals as it can subscribe to", ^{
+		__block id<RACSubscriber> signalsSubscriber;
+		__block RACDemand *upstreamDemand;
+
+		RACSignal *signals = [RACSignal createSignal:^ RACDisposable * (id<RACSubscriber> subscriber) {
+			signalsSubscriber = subscriber;
+			upstreamDemand = [RACDemand demandForSubscriber:subscriber];
+			return nil;
+		}];
+
+		NSMutableArray *values = [NSMutableArray array];
+		[[signals flatten:2] subscribeNext:^(id x) {
+			[values addObject:x];
+		}];
+
+		expect(upstreamDemand).notTo(beNil());
+		expect(@(upstreamDemand.outstandingCount)).to(equal(@2));
+
+		RACSubject *subject1 = [RACSubject subject];
+		RACSubject *subject2 = [RACSubject subject];
+		[signalsSubscriber sendNext:subject1];
+		[signalsSubscriber sendNext:subject2];
+		expect(@(upstreamDemand.outstandingCount)).to(equal(@0));
+
+		[subject1 sendNext:@1];
+		[subject1 sendCompleted];
+		expect(@(upstreamDemand.outstandingCount)).to(equal(@1));
+
+		[subject2 sendNext:@2];
+		expect(values).to(equal(@[ @1, @2 ]));
+	});
+
+	qck_it(@"should not lose demand to nil signals", ^{
+		__block id<RACSubscriber> signalsSubscriber;
+		__block RACDemand *upstreamDemand;
+
+		RACSignal *signals = [RACSignal createSignal:^ RACDisposable * (id<RACSubscriber> subscriber) {
+			signalsSubscriber = subscriber;
+			upstreamDemand = [RACDemand demandForSubscriber:subscriber];
+			return nil;
+		}];
+
+		[[signals flatten:2] subscribeCompleted:^{}];
+		expect(@(upstreamDemand.outstandingCount)).to(equal(@2));
+
+		[signalsSubscriber sendNext:nil];
+		[signalsSubscriber sendNext:nil];
+		[signalsSubscriber sendNext:nil];
+		expect(@(upstreamDemand.outstandingCount)).to(equal(@2));
+
+		[signalsSubscriber sendNext:[RACSubject subject]];
+		expect(@(upstreamDemand.outstandingCount)).to(equal(@1));
+	});
+
+	qck_it(@"should not advertise demand when concurrency is unbounded", ^{
+		__block RACDemand *upstreamDemand = [[RACDemand alloc] init];
+
+		RACSignal *signals = [RACSignal createSignal:^ RACDisposable * (id<RACSubscriber> subscriber) {
+			upstreamDemand = [RACDemand demandForSubscriber:subscriber];
+			return nil;
+		}];
+
+		[[signals flatten:0] subscribeCompleted:^{}];
+		expect(upstreamDemand).to(beNil());
+	});
+});
+
+QuickSpecEnd
@@ -0,0 +1,137 @@
+//
+//  RACMetricsSpec.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Quick/Quick.h>
+#import <Nimble/Nimble.h>
+
+#import "RACDisposable.h"
+#import "RACMetrics.h"
+#import "RACScheduler.h"
+#import "RACSignal+Operations.h"
+#import "RACSubject.h"
+
+QuickSpecBegin(RACMetricsSpec)
+
+__block RACSubject *subject;
+
+qck_beforeEach(^{
+	[RACMetrics reset];
+	[RACMetrics setEnabled:YES];
+
+	subject = [RACSubject subject];
+	[subject setName:@"RACMetricsSpec subject"];
+});
+
+qck_afterEach(^{
+	[RACMetrics setEnabled:NO];
+	[RACMetrics reset];
+});
+
+qck_it(@"should count events per signal", ^{
+	[subject subscribeNext:^(id _) {}];
+	[subject sendNext:@1];
+	[subject sendNext:@2];
+	[subject sendCompleted];
+
+	RACMetricsEntry *entry = RACMetrics.snapshot.signals[@"RACMetricsSpec subject"];
+	expect(entry).notTo(beNil());
+	expect(@(entry.nextCount)).to(equal(@2));
+	expect(@(entry.errorCount)).to(equal(@0));
+	expect(@(entry.completedCount)).to(equal(@1));
+	expect(@(entry.callbackCount)).to(equal(@3));
+});
+
+qck_it(@"should track subscribers", ^{
+	RACDisposable *first = [subject subscribeNext:^(id _) {}];
+	[subject subscribeNext:^(id _) {}];
+
+	RACMetricsEntry *entry = RACMetrics.snapshot.signals[@"RACMetricsSpec subject"];
+	expect(@(entry.subscriberCount)).to(equal(@2));
+	expect(@(entry.subscriptionCount)).to(equal(@2));
+
+	[first dispose];
+
+	entry = RACMetrics.snapshot.signals[@"RACMetricsSpec subject"];
+	expect(@(entry.subscriberCount)).to(equal(@1));
+	expect(@(entry.subscriptionCount)).to(equal(@2));
+});
+
+qck_it(@"should record callback durations", ^{
+	[subject subscribeNext:^(id _) {
+		[NSThread sleepForTimeInterval:0.01];
+	}];
+
+	[subject sendNext:@1];
+
+	RACMetricsEntry *entry = RACMetrics.snapshot.signals[@"RACMetricsSpec subject"];
+	expect(@(entry.maximumCallbackDuration >= 0.01)).to(beTruthy());
+	expect(@([entry callbackDurationAtPercentile:1])).to(equal(@(entry.maximumCallbackDuration)));
+
+	// Histogram buckets are within 25% of the exact duration.
+	expect(@([entry callbackDurationAtPercentile:0.5] >= 0.01 * 0.75)).to(beTruthy());
+});
+
+qck_it(@"should sum events recorded on other threads", ^{
+	RACSignal *signal = [[RACSignal return:@1] subscribeOn:[RACScheduler scheduler]];
+	[signal setName:@"RACMetricsSpec background"];
+
+	expect(@([signal waitUntilCompleted:NULL])).to(beTruthy());
+
+	// Events are recorded after they've been delivered, so the completion may
+	// be observed first.
+	expect(@([RACMetrics.snapshot.signals[@"RACMetricsSpec background"] completedCount])).toEventually(equal(@1));
+	expect(@([RACMetrics.snapshot.signals[@"RACMetricsSpec background"] nextCount])).to(equal(@1));
+});
+
+qck_it(@"should record blocks run by schedulers", ^{
+	RACScheduler *scheduler = [RACScheduler schedulerWithPriority:RACSchedulerPriorityDefault name:@"RACMetricsSpec scheduler"];
+
+	__block BOOL done = NO;
+	[scheduler schedule:^{
+		done = YES;
+	}];
+
+	expect(@(done)).toEventually(beTruthy());
+	expect(@([RACMetrics.snapshot.schedulers[@"RACMetricsSpec scheduler"] callbackCount])).toEventually(equal(@1));
+});
+
+qck_it(@"should not record subscriptions made while disabled", ^{
+	[RACMetrics setEnabled:NO];
+
+	[subject subscribeNext:^(id _) {}];
+	[RACMetrics setEnabled:YES];
+	[subject sendNext:@1];
+
+	expect(RACMetrics.snapshot.signals[@"RACMetricsSpec subject"]).to(beNil());
+});
+
+qck_it(@"should discard metrics when reset", ^{
+	[subject subscribeNext:^(id _) {}];
+	[subject sendNext:@1];
+
+	[RACMetrics reset];
+	expect(RACMetrics.snapshot.signals[@"RACMetricsSpec subject"]).to(beNil());
+
+	[subject sendNext:@2];
+	expect(@([RACMetrics.snapshot.signals[@"RACMetricsSpec subject"] nextCount])).to(equal(@1));
+});
+
+qck_it(@"should serialize snapshots as JSON", ^{
+	[subject subscribeNext:^(id _) {}];
+	[subject sendNext:@1];
+
+	NSData *data = RACMetrics.snapshot.JSONData;
+	NSDictionary *JSON = [NSJSONSerialization JSONObjectWithData:data options:0 error:NULL];
+
+	NSDictionary *entry = JSON[@"signals"][@"RACMetricsSpec subject"];
+	expect(entry[@"next"]).to(equal(@1));
+	expect(entry[@"subscribers"]).to(equal(@1));
+	expect(@([entry[@"callbackDuration"][@"histogram"] count])).to(equal(@1));
+});
+
+QuickSpecEnd
@@ -0,0 +1,250 @@
+//
+//  RACParallelSchedulerSpec.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Quick/Quick.h>
+#import <Nimble/Nimble.h>
+
+#import "NSArray+RACSequenceAdditions.h"
+#import "RACDisposable.h"
+#import "RACParallelScheduler.h"
+#import "RACSequence.h"
+#import "RACSignal+Operations.h"
+#import "RACSubject.h"
+#import <libkern/OSAtomic.h>
+
+QuickSpecBegin(RACParallelSchedulerSpec)
+
+__block RACParallelScheduler *scheduler;
+
+qck_beforeEach(^{
+	scheduler = [[RACParallelScheduler alloc] initWithWorkerCount:4];
+});
+
+qck_it(@"should default to one worker for each active processor", ^{
+	RACParallelScheduler *defaultScheduler = [[RACParallelScheduler alloc] init];
+	expect(@(defaultScheduler.workerCount)).to(equal(@(NSProcessInfo.processInfo.activeProcessorCount)));
+});
+
+qck_it(@"should run every scheduled block", ^{
+	__block volatile int32_t runCount = 0;
+
+	for (NSUInteger i = 0; i < 10000; i++) {
+		[scheduler schedule:^{
+			OSAtomicIncrement32Barrier(&runCount);
+		}];
+	}
+
+	expect(@(runCount)).toEventually(equal(@10000));
+});
+
+qck_it(@"should run blocks scheduled from its own workers", ^{
+	__block volatile int32_t runCount = 0;
+
+	for (NSUInteger i = 0; i < 100; i++) {
+		[scheduler schedule:^{
+			for (NSUInteger j = 0; j < 100; j++) {
+				[scheduler schedule:^{
+					OSAtomicIncrement32Barrier(&runCount);
+				}];
+			}
+		}];
+	}
+
+	expect(@(runCount)).toEventually(equal(@10000));
+});
+
+qck_it(@"should run blocks concurrently", ^{
+	__block volatile int32_t runningCount = 0;
+	__block volatile int32_t maximumRunningCount = 0;
+
+	for (NSUInteger i = 0; i < 4; i++) {
+		[scheduler schedule:^{
+			int32_t running = OSAtomicIncrement32Barrier(&runningCount);
+
+			// Wait until every block is running at once, or we time out.
+			NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:1];
+			while (runningCount < 4 && deadline.timeIntervalSinceNow > 0) {
+				[NSThread sleepForTimeInterval:0.001];
+			}
+
+			if (running > maximumRunningCount) maximumRunningCount = running;
+		}];
+	}
+
+	expect(@(maximumRunningCount)).toEventually(equal(@4));
+});
+
+qck_it(@"should cancel blocks which haven't started", ^{
+	__block BOOL ran = NO;
+
+	// Keep every worker busy, so the next block is left queued.
+	__block volatile uint32_t waiting = 1;
+	for (NSUInteger i = 0; i < 4; i++) {
+		[scheduler schedule:^{
+			while (waiting == 1) ;
+		}];
+	}
+
+	RACDisposable *disposable = [scheduler schedule:^{
+		ran = YES;
+	}];
+
+	[disposable dispose];
+	OSAtomicAnd32Barrier(0, &waiting);
+
+	__block BOOL done = NO;
+	[scheduler schedule:^{
+		done = YES;
+	}];
+
+	expect(@(done)).toEventually(beTruthy());
+	expect(@(ran)).to(beFalsy());
+});
+
+qck_describe(@"-parallelMap:onScheduler:ordered:", ^{
+	__block NSArray *values;
+	__block id (^slowSquare)(id);
+
+	qck_beforeEach(^{
+		NSMutableArray *mutableValues = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 100; i++) {
+			[mutableValues addObject:@(i)];
+		}
+
+		values = mutableValues;
+
+		slowSquare = ^(NSNumber *value) {
+			// Make later values finish sooner, so they arrive out of order.
+			[NSThread sleepForTimeInterval:(value.unsignedIntegerValue % 7) * 0.0005];
+			return @(value.unsignedIntegerValue * value.unsignedIntegerValue);
+		};
+	});
+
+	qck_it(@"should send mapped values in order", ^{
+		NSArray *results = [[values.rac_sequence.signal parallelMap:slowSquare onScheduler:scheduler ordered:YES] toArray];
+
+		NSMutableArray *expected = [NSMutableArray array];
+		for (NSNumber *value in values) {
+			[expected addObject:@(value.unsignedIntegerValue * value.unsignedIntegerValue)];
+		}
+
+		expect(results).to(equal(expected));
+	});
+
+	qck_it(@"should send every mapped value when unordered", ^{
+		NSArray *results = [[values.rac_sequence.signal parallelMap:slowSquare onScheduler:scheduler ordered:NO] toArray];
+
+		NSMutableSet *expected = [NSMutableSet set];
+		for (NSNumber *value in values) {
+			[expected addObject:@(value.unsignedIntegerValue * value.unsignedIntegerValue)];
+		}
+
+		expect(@(results.count)).to(equal(@(values.count)));
+		expect([NSSet setWithArray:results]).to(equal(expected));
+	});
+
+	qck_it(@"should map values concurrently", ^{
+		__block volatile int32_t runningCount = 0;
+		__block volatile int32_t maximumRunningCount = 0;
+
+		RACSignal *signal = [values.rac_sequence.signal parallelMap:^(id value) {
+			int32_t running = OSAtomicIncrement32Barrier(&runningCount);
+			if (running > maximumRunningCount) maximumRunningCount = running;
+
+			[NSThread sleepForTimeInterval:0.001];
+
+			OSAtomicDecrement32Barrier(&runningCount);
+			return value;
+		} onScheduler:scheduler ordered:YES];
+
+		expect(@([signal waitUntilCompleted:NULL])).to(beTruthy());
+		expect(@(maximumRunningCount)).to(beGreaterThan(@1));
+	});
+
+	qck_it(@"should pass through nil values", ^{
+		NSArray *results = [[[RACSignal return:@1] parallelMap:^ id (id _) {
+			return nil;
+		} onScheduler:scheduler ordered:YES] toArray];
+
+		expect(results).to(equal(@[ NSNull.null ]));
+	});
+
+	qck_it(@"should forward errors", ^{
+		RACSubject *subject = [RACSubject subject];
+		NSError *error = [NSError errorWithDomain:@"RACParallelSchedulerSpec" code:1 userInfo:nil];
+
+		__block NSError *receivedError;
+		[[subject parallelMap:slowSquare onScheduler:scheduler ordered:YES] subscribeError:^(NSError *e) {
+			receivedError = e;
+		}];
+
+		[subject sendNext:@1];
+		[subject sendError:error];
+
+		expect(receivedError).toEventually(equal(error));
+	});
+
+	qck_it(@"should not deadlock when chained on the same scheduler", ^{
+		RACSignal *signal = [[values.rac_sequence.signal
+			parallelMap:slowSquare onScheduler:scheduler ordered:YES]
+			parallelMap:^(NSNumber *value) {
+				return @(value.unsignedIntegerValue + 1);
+			} onScheduler:scheduler ordered:YES];
+
+		NSMutableArray *expected = [NSMutableArray array];
+		for (NSNumber *value in values) {
+			[expected addObject:@(value.unsignedIntegerValue * value.unsignedIntegerValue + 1)];
+		}
+
+		__block NSArray *results;
+		[[signal collect] subscribeNext:^(NSArray *x) {
+			results = x;
+		}];
+
+		expect(results).toEventually(equal(expected));
+	});
+
+	qck_it(@"should not map any more values once disposed", ^{
+		__block volatile int32_t mapCount = 0;
+
+		RACSignal *signal = [values.rac_sequence.signal parallelMap:^(id value) {
+			OSAtomicIncrement32Barrier(&mapCount);
+			[NSThread sleepForTimeInterval:0.01];
+			return value;
+		} onScheduler:scheduler ordered:YES];
+
+		__block BOOL received = NO;
+		RACDisposable *disposable = [signal subscribeNext:^(id _) {
+			received = YES;
+		}];
+
+		expect(@(received)).toEventually(beTruthy());
+		[disposable dispose];
+
+		int32_t countAtDisposal = mapCount;
+		[NSThread sleepForTimeInterval:0.1];
+
+		expect(@(mapCount)).to(equal(@(countAtDisposal)));
+	});
+
+	qck_it(@"should stop sending values once disposed", ^{
+		__block NSUInteger receivedCount = 0;
+		__block BOOL completed = NO;
+
+		[[[values.rac_sequence.signal parallelMap:slowSquare onScheduler:scheduler ordered:YES] take:5] subscribeNext:^(id _) {
+			receivedCount++;
+		} completed:^{
+			completed = YES;
+		}];
+
+		expect(@(completed)).toEventually(beTruthy());
+		expect(@(receivedCount)).to(equal(@5));
+	});
+});
+
+QuickSpecEnd
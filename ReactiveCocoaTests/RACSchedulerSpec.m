@@ -15,6 +15,7 @@
 #import "RACDisposable.h"
 #import "EXTScope.h"
 #import "RACTestExampleScheduler.h"
+#import "RACTestScheduler.h"
 #import <libkern/OSAtomic.h>
 
 // This shouldn't be used directly. Use the `expectCurrentSchedulers` block
@@ -57,6 +58,38 @@ qck_it(@"should know its current scheduler", ^{
 	expectCurrentSchedulers(backgroundJumper, backgroundJumper);
 });
 
+qck_it(@"should restore the previous current scheduler after a nested scheduler runs", ^{
+	RACScheduler *backgroundScheduler = [RACScheduler scheduler];
+	RACTestScheduler *testScheduler = [[RACTestScheduler alloc] init];
+
+	NSMutableArray *currentSchedulers = [NSMutableArray array];
+
+	[testScheduler schedule:^{
+		[currentSchedulers addObject:RACScheduler.currentScheduler];
+	}];
+
+	[backgroundScheduler schedule:^{
+		[currentSchedulers addObject:RACScheduler.currentScheduler];
+		[testScheduler step];
+		[currentSchedulers addObject:RACScheduler.currentScheduler];
+	}];
+
+	expect(currentSchedulers).toEventually(equal((@[ backgroundScheduler, testScheduler, backgroundScheduler ])));
+});
+
+qck_it(@"should not have a current scheduler on a background thread outside of any scheduler", ^{
+	__block BOOL done = NO;
+	__block RACScheduler *currentScheduler = RACScheduler.immediateScheduler;
+
+	dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+		currentScheduler = RACScheduler.currentScheduler;
+		done = YES;
+	});
+
+	expect(@(done)).toEventually(beTruthy());
+	expect(currentScheduler).to(beNil());
+});
+
 qck_describe(@"+mainThreadScheduler", ^{
 	qck_it(@"should cancel scheduled blocks when disposed", ^{
 		__block BOOL firstBlockRan = NO;
@@ -198,6 +231,36 @@ qck_describe(@"+scheduler", ^{
 		expect(@(firstBlockRan)).to(beFalsy());
 	});
 
+	qck_it(@"should schedule blocks after a number of nanoseconds", ^{
+		__block BOOL done = NO;
+
+		[scheduler afterNanoseconds:10 * NSEC_PER_MSEC schedule:^{
+			done = YES;
+		}];
+
+		expect(@(done)).to(beFalsy());
+		expect(@(done)).toEventually(beTruthy());
+	});
+
+	qck_it(@"should cancel blocks scheduled after a number of nanoseconds when disposed", ^{
+		__block BOOL firstBlockRan = NO;
+		__block BOOL secondBlockRan = NO;
+
+		RACDisposable *disposable = [scheduler afterNanoseconds:10 * NSEC_PER_MSEC schedule:^{
+			firstBlockRan = YES;
+		}];
+
+		expect(disposable).notTo(beNil());
+		[disposable dispose];
+
+		[scheduler afterNanoseconds:10 * NSEC_PER_MSEC schedule:^{
+			secondBlockRan = YES;
+		}];
+
+		expect(@(secondBlockRan)).toEventually(beTruthy());
+		expect(@(firstBlockRan)).to(beFalsy());
+	});
+
 	qck_it(@"should schedule recurring blocks", ^{
 		__block NSUInteger count = 0;
 
@@ -215,6 +278,24 @@ qck_describe(@"+scheduler", ^{
 
 		expect(@(count)).to(beGreaterThanOrEqualTo(@3));
 	});
+
+	qck_it(@"should schedule recurring blocks every number of nanoseconds", ^{
+		__block NSUInteger count = 0;
+
+		RACDisposable *disposable = [scheduler afterNanoseconds:0 repeatingEveryNanoseconds:50 * NSEC_PER_MSEC withLeewayNanoseconds:0 schedule:^{
+			count++;
+		}];
+
+		expect(@(count)).toEventually(beGreaterThanOrEqualTo(@3));
+
+		[disposable dispose];
+		[NSThread sleepForTimeInterval:0.1];
+
+		NSUInteger finalCount = count;
+		[NSThread sleepForTimeInterval:0.1];
+
+		expect(@(count)).to(equal(@(finalCount)));
+	});
 });
 
 qck_describe(@"+subscriptionScheduler", ^{
@@ -295,6 +376,16 @@ qck_describe(@"+immediateScheduler", ^{
 		expect(@(executed)).to(beTruthy());
 		expect(disposable).to(beNil());
 	});
+
+	qck_it(@"should block for blocks scheduled after a number of nanoseconds", ^{
+		__block BOOL executed = NO;
+		RACDisposable *disposable = [RACScheduler.immediateScheduler afterNanoseconds:10 * NSEC_PER_MSEC schedule:^{
+			executed = YES;
+		}];
+
+		expect(@(executed)).to(beTruthy());
+		expect(disposable).to(beNil());
+	});
 });
 
 qck_describe(@"-scheduleRecursiveBlock:", ^{
@@ -336,6 +427,35 @@ qck_describe(@"-scheduleRecursiveBlock:", ^{
 
 			expect(@(scheduleCount)).to(equal(@(depth)));
 		});
+
+		qck_it(@"should run every iteration at the same stack depth", ^{
+			// Returns how far the stack grew beyond the first iteration.
+			uintptr_t (^measureStackGrowth)(RACScheduler *) = ^(RACScheduler *scheduler) {
+				__block NSUInteger count = 0;
+				__block uintptr_t firstFrame = 0;
+				__block uintptr_t maximumGrowth = 0;
+
+				[scheduler scheduleRecursiveBlock:^(void (^recurse)(void)) {
+					char marker;
+					uintptr_t frame = (uintptr_t)&marker;
+
+					// The stack grows down.
+					if (firstFrame == 0) firstFrame = frame;
+					if (frame < firstFrame) maximumGrowth = MAX(maximumGrowth, firstFrame - frame);
+
+					if (++count < 1000) recurse();
+				}];
+
+				expect(@(count)).to(equal(@1000));
+				return maximumGrowth;
+			};
+
+			expect(@(measureStackGrowth(RACScheduler.immediateScheduler))).to(equal(@0));
+
+			// This runs on the main thread, so the subscription scheduler
+			// schedules synchronously.
+			expect(@(measureStackGrowth(RACScheduler.subscriptionScheduler))).to(equal(@0));
+		});
 	});
 
 	qck_describe(@"with an asynchronous scheduler", ^{
@@ -385,6 +505,40 @@ qck_describe(@"-scheduleRecursiveBlock:", ^{
 			expect(@(count)).toEventually(equal(@3));
 		});
 
+		qck_it(@"should unroll deep recursion", ^{
+			static const NSUInteger depth = 100000;
+			__block NSUInteger scheduleCount = 0;
+			[[RACScheduler scheduler] scheduleRecursiveBlock:^(void (^recurse)(void)) {
+				scheduleCount++;
+
+				if (scheduleCount < depth) recurse();
+			}];
+
+			expect(@(scheduleCount)).toEventually(equal(@(depth)));
+		});
+
+		qck_it(@"should let other blocks run while it recurses", ^{
+			RACScheduler *scheduler = [RACScheduler scheduler];
+
+			__block NSUInteger count = 0;
+			__block NSUInteger countWhenOtherBlockRan = 0;
+
+			[scheduler schedule:^{
+				[scheduler scheduleRecursiveBlock:^(void (^recurse)(void)) {
+					if (++count < 10000) recurse();
+				}];
+
+				[scheduler schedule:^{
+					countWhenOtherBlockRan = count;
+				}];
+			}];
+
+			// The first iteration was already queued before the other block,
+			// but every later one is rescheduled behind it.
+			expect(@(count)).toEventually(equal(@10000));
+			expect(@(countWhenOtherBlockRan)).to(equal(@1));
+		});
+
 		qck_it(@"shouldn't reschedule itself when disposed", ^{
 			__block NSUInteger count = 0;
 			__block RACDisposable *disposable = [RACScheduler.mainThreadScheduler scheduleRecursiveBlock:^(void (^recurse)(void)) {
@@ -44,6 +44,29 @@ QuickConfigurationBegin(RACSequenceExampleGroups)
 			expect(sequence.array).to(equal(values));
 		});
 
+		qck_it(@"should return an enumerator of every value", ^{
+			NSMutableArray *collectedValues = [NSMutableArray array];
+
+			NSEnumerator *enumerator = sequence.objectEnumerator;
+			id value;
+			while ((value = enumerator.nextObject) != nil) {
+				[collectedValues addObject:value];
+			}
+
+			expect(collectedValues).to(equal(values));
+		});
+
+		qck_it(@"should fast enumerate its tail", ^{
+			if (values.count == 0) return;
+
+			NSMutableArray *collectedValues = [NSMutableArray array];
+			for (id value in sequence.tail) {
+				[collectedValues addObject:value];
+			}
+
+			expect(collectedValues).to(equal([values subarrayWithRange:NSMakeRange(1, values.count - 1)]));
+		});
+
 		qck_describe(@"-signalWithScheduler:", ^{
 			qck_it(@"should return an immediately scheduled signal", ^{
 				RACSignal *signal = [sequence signalWithScheduler:RACScheduler.immediateScheduler];
@@ -77,6 +100,38 @@ QuickConfigurationBegin(RACSequenceExampleGroups)
 			});
 		});
 
+		qck_describe(@"-signalWithScheduler:batchSize:", ^{
+			qck_it(@"should return an immediately scheduled signal", ^{
+				RACSignal *signal = [sequence signalWithScheduler:RACScheduler.immediateScheduler batchSize:2];
+				expect(signal.toArray).to(equal(values));
+			});
+
+			qck_it(@"should return a background scheduled signal", ^{
+				RACSignal *signal = [sequence signalWithScheduler:[RACScheduler scheduler] batchSize:2];
+				expect(signal.toArray).to(equal(values));
+			});
+
+			qck_it(@"should evaluate at most one batch per scheduling", ^{
+				RACSignal *signal = [sequence signalWithScheduler:RACScheduler.mainThreadScheduler batchSize:2];
+
+				__block NSUInteger valuesSinceYield = 0;
+				__block BOOL completed = NO;
+				[signal subscribeNext:^(id x) {
+					expect(@(valuesSinceYield)).to(beLessThan(@2));
+					if (valuesSinceYield++ > 0) return;
+
+					[RACScheduler.mainThreadScheduler schedule:^{
+						// This should get executed before the next batch.
+						valuesSinceYield = 0;
+					}];
+				} completed:^{
+					completed = YES;
+				}];
+
+				expect(@(completed)).toEventually(beTruthy());
+			});
+		});
+
 		qck_it(@"should be equal to itself", ^{
 			expect(sequence).to(equal(sequence));
 		});
@@ -19,6 +19,7 @@
 #import "RACDisposable.h"
 #import "RACSequence.h"
 #import "RACUnit.h"
+#import <libkern/OSAtomic.h>
 
 QuickSpecBegin(RACSequenceSpec)
 
@@ -96,6 +97,202 @@ qck_describe(@"+sequenceWithHeadBlock:tailBlock:", ^{
 	});
 });
 
+qck_describe(@"memoization", ^{
+	__block volatile int32_t evaluationCount;
+	__block RACSequence *sequence;
+
+	qck_beforeEach(^{
+		evaluationCount = 0;
+
+		NSMutableArray *values = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 1000; i++) {
+			[values addObject:@(i)];
+		}
+
+		sequence = [values.rac_sequence map:^(NSNumber *value) {
+			OSAtomicIncrement32Barrier(&evaluationCount);
+			return @(value.integerValue * 2);
+		}];
+	});
+
+	qck_it(@"should evaluate each value once when iterated repeatedly", ^{
+		for (NSUInteger i = 0; i < 10; i++) {
+			NSUInteger count = 0;
+			for (NSNumber *value in sequence) {
+				expect(value).to(equal(@(count * 2)));
+				count++;
+			}
+
+			expect(@(count)).to(equal(@1000));
+		}
+
+		expect(@(evaluationCount)).to(equal(@1000));
+	});
+
+	qck_it(@"should evaluate each value once when iterated concurrently", ^{
+		const size_t threadCount = 8;
+		__block volatile int32_t mismatchCount = 0;
+
+		dispatch_apply(threadCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t _) {
+			NSUInteger count = 0;
+			for (NSNumber *value in sequence) {
+				if (value.unsignedIntegerValue != count * 2) OSAtomicIncrement32Barrier(&mismatchCount);
+				count++;
+			}
+
+			if (count != 1000) OSAtomicIncrement32Barrier(&mismatchCount);
+		});
+
+		expect(@(mismatchCount)).to(equal(@0));
+		expect(@(evaluationCount)).to(equal(@1000));
+	});
+});
+
+qck_describe(@"fused pipelines", ^{
+	__block NSArray *values;
+	__block NSUInteger mapCount;
+	__block NSUInteger filterCount;
+	__block RACSequence *sequence;
+
+	qck_beforeEach(^{
+		NSMutableArray *mutableValues = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 100; i++) {
+			[mutableValues addObject:@(i)];
+		}
+
+		values = mutableValues;
+		mapCount = 0;
+		filterCount = 0;
+
+		sequence = [[[values.rac_sequence
+			map:^(NSNumber *value) {
+				mapCount++;
+				return @(value.integerValue * 3);
+			}]
+			filter:^(NSNumber *value) {
+				filterCount++;
+				return (BOOL)(value.integerValue % 2 == 0);
+			}]
+			take:10];
+	});
+
+	qck_itBehavesLike(RACSequenceExamples, ^{
+		return @{
+			RACSequenceExampleSequence: sequence,
+			RACSequenceExampleExpectedValues: @[ @0, @6, @12, @18, @24, @30, @36, @42, @48, @54 ]
+		};
+	});
+
+	qck_it(@"should run each value through every stage in one pass", ^{
+		expect(sequence.array).to(equal(@[ @0, @6, @12, @18, @24, @30, @36, @42, @48, @54 ]));
+
+		// The 10th even multiple of 3 comes from the 19th value.
+		expect(@(mapCount)).to(equal(@19));
+		expect(@(filterCount)).to(equal(@19));
+	});
+
+	qck_it(@"should give the same values when traversed by hand", ^{
+		NSMutableArray *collectedValues = [NSMutableArray array];
+		for (RACSequence *seq = sequence; seq.head != nil; seq = seq.tail) {
+			[collectedValues addObject:seq.head];
+		}
+
+		expect(collectedValues).to(equal(sequence.array));
+	});
+
+	qck_it(@"should fold left", ^{
+		NSNumber *sum = [sequence foldLeftWithStart:@0 reduce:^(NSNumber *accumulator, NSNumber *value) {
+			return @(accumulator.integerValue + value.integerValue);
+		}];
+
+		expect(sum).to(equal(@270));
+	});
+
+	qck_it(@"should only map each value once when folded", ^{
+		RACSequence *mapped = [values.rac_sequence map:^(NSNumber *value) {
+			mapCount++;
+			return @(value.integerValue * 3);
+		}];
+
+		NSNumber *sum = [mapped foldLeftWithStart:@0 reduce:^(NSNumber *accumulator, NSNumber *value) {
+			return @(accumulator.integerValue + value.integerValue);
+		}];
+
+		expect(sum).to(equal(@14850));
+		expect(@(mapCount)).to(equal(@(values.count)));
+	});
+
+	qck_it(@"should only evaluate each value once when enumerated repeatedly", ^{
+		NSArray *expected = @[ @0, @6, @12, @18, @24, @30, @36, @42, @48, @54 ];
+		expect(sequence.array).to(equal(expected));
+		expect(sequence.array).to(equal(expected));
+
+		expect(@(mapCount)).to(equal(@19));
+		expect(@(filterCount)).to(equal(@19));
+	});
+
+	qck_it(@"should give the same objects from -head and fast enumeration", ^{
+		RACSequence *objects = [values.rac_sequence map:^(id _) {
+			return [[NSObject alloc] init];
+		}];
+
+		id head = objects.head;
+		expect(objects.array[0]).to(beIdenticalTo(head));
+		expect(objects.tail.head).to(beIdenticalTo(objects.array[1]));
+	});
+
+	qck_it(@"should apply -take: at its position in the pipeline", ^{
+		RACSequence *takeThenFilter = [[values.rac_sequence take:10] filter:^(NSNumber *value) {
+			return (BOOL)(value.integerValue % 2 == 0);
+		}];
+
+		expect(takeThenFilter.array).to(equal(@[ @0, @2, @4, @6, @8 ]));
+	});
+
+	qck_it(@"should drop values mapped to nil", ^{
+		RACSequence *mapped = [values.rac_sequence map:^ id (NSNumber *value) {
+			return (value.integerValue < 3 ? value : nil);
+		}];
+
+		expect(mapped.array).to(equal(@[ @0, @1, @2 ]));
+	});
+
+	qck_it(@"should not evaluate values beyond a -take:", ^{
+		__block NSUInteger headCount = 0;
+
+		__block RACSequence * (^sequenceFromIndex)(NSUInteger);
+		sequenceFromIndex = ^(NSUInteger index) {
+			return [RACSequence sequenceWithHeadBlock:^{
+				++headCount;
+				return @(index);
+			} tailBlock:^{
+				return sequenceFromIndex(index + 1);
+			}];
+		};
+
+		NSArray *taken = [[sequenceFromIndex(0) map:^(NSNumber *value) {
+			return @(value.integerValue * 2);
+		}] take:3].array;
+
+		// Break the retain cycle.
+		sequenceFromIndex = nil;
+
+		expect(taken).to(equal(@[ @0, @2, @4 ]));
+		expect(@(headCount)).to(equal(@3));
+	});
+
+	qck_it(@"should evaluate eager sequences immediately", ^{
+		RACSequence *eagerSequence = [values.rac_sequence.eagerSequence map:^(NSNumber *value) {
+			mapCount++;
+			return value;
+		}];
+
+		expect(@(mapCount)).to(equal(@100));
+		expect(eagerSequence.array).to(equal(values));
+		expect(@(mapCount)).to(equal(@100));
+	});
+});
+
 qck_describe(@"empty sequences", ^{
 	qck_itBehavesLike(RACSequenceExamples, ^{
 		return @{
@@ -319,6 +516,46 @@ qck_it(@"shouldn't overflow the stack when deallocated on a background queue", ^
 	expect(@(finished)).toEventually(beTruthy());
 });
 
+qck_it(@"should release each link of a long chain as soon as it's deallocated", ^{
+	NSUInteger length = 100000;
+	NSMutableArray *values = [NSMutableArray arrayWithCapacity:length];
+	for (NSUInteger i = 0; i < length; ++i) {
+		[values addObject:@(i)];
+	}
+
+	__block BOOL finished = NO;
+	__block BOOL lastDeallocated = NO;
+
+	dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+		RACSequence *sequence;
+		__weak RACSequence *weakLast;
+
+		@autoreleasepool {
+			sequence = [values.rac_sequence flattenMap:^(id value) {
+				return [RACSequence return:value];
+			}];
+
+			// Evaluate the whole chain.
+			RACSequence *last = sequence;
+			while (last.tail.head != nil) {
+				last = last.tail;
+			}
+
+			weakLast = last;
+		}
+
+		// Nothing is left on an autorelease pool, so the whole chain should be
+		// gone right away.
+		sequence = nil;
+		lastDeallocated = (weakLast == nil);
+
+		finished = YES;
+	});
+
+	expect(@(finished)).toEventually(beTruthy());
+	expect(@(lastDeallocated)).to(beTruthy());
+});
+
 qck_describe(@"-foldLeftWithStart:reduce:", ^{
 	qck_it(@"should reduce with start first", ^{
 		RACSequence *sequence = [[[RACSequence return:@0] concat:[RACSequence return:@1]] concat:[RACSequence return:@2]];
@@ -375,6 +612,142 @@ qck_describe(@"-foldRightWithStart:reduce:", ^{
 		}];
 		expect(result).to(equal(@2));
 	});
+
+	qck_it(@"should not recurse for each value of an eager sequence", ^{
+		NSUInteger length = 100000;
+		NSMutableArray *values = [NSMutableArray arrayWithCapacity:length];
+		for (NSUInteger i = 0; i < length; ++i) {
+			[values addObject:@(i)];
+		}
+
+		__block NSNumber *result;
+		dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+			result = [values.rac_sequence.eagerSequence foldRightWithStart:@0 reduce:^(NSNumber *first, RACSequence *rest) {
+				return @(first.longLongValue + [rest.head longLongValue]);
+			}];
+		});
+
+		expect(result).toEventually(equal(@((long long)length * (length - 1) / 2)));
+	});
+});
+
+qck_describe(@"parallel operations", ^{
+	__block NSArray *values;
+
+	qck_beforeEach(^{
+		NSMutableArray *mutableValues = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 100000; i++) {
+			[mutableValues addObject:@(i)];
+		}
+
+		values = mutableValues;
+	});
+
+	qck_it(@"should map values in order", ^{
+		RACSequence *sequence = [values.rac_sequence parallelMap:^(NSNumber *value) {
+			return @(value.integerValue * 2);
+		}];
+
+		RACSequence *expected = [values.rac_sequence map:^(NSNumber *value) {
+			return @(value.integerValue * 2);
+		}];
+
+		expect(sequence.array).to(equal(expected.array));
+	});
+
+	qck_it(@"should skip values mapped to nil", ^{
+		RACSequence *sequence = [values.rac_sequence parallelMap:^ id (NSNumber *value) {
+			return (value.integerValue % 1000 == 0 ? value : nil);
+		}];
+
+		expect(@(sequence.array.count)).to(equal(@100));
+		expect(sequence.head).to(equal(@0));
+		expect(sequence.tail.head).to(equal(@1000));
+	});
+
+	qck_it(@"should map values concurrently", ^{
+		__block volatile int32_t runningCount = 0;
+		__block volatile int32_t maximumRunningCount = 0;
+
+		[[values.rac_sequence take:64] parallelMap:^(NSNumber *value) {
+			int32_t running = OSAtomicIncrement32Barrier(&runningCount);
+			if (running > maximumRunningCount) maximumRunningCount = running;
+
+			[NSThread sleepForTimeInterval:0.001];
+
+			OSAtomicDecrement32Barrier(&runningCount);
+			return value;
+		}];
+
+		if (NSProcessInfo.processInfo.activeProcessorCount > 1) {
+			expect(@(maximumRunningCount)).to(beGreaterThan(@1));
+		}
+	});
+
+	qck_it(@"should filter values in order", ^{
+		BOOL (^isMultipleOfThree)(NSNumber *) = ^(NSNumber *value) {
+			return (BOOL)(value.integerValue % 3 == 0);
+		};
+
+		RACSequence *sequence = [values.rac_sequence parallelFilter:isMultipleOfThree];
+		expect(sequence.array).to(equal([values.rac_sequence filter:isMultipleOfThree].array));
+	});
+
+	qck_it(@"should reduce values like a left fold", ^{
+		id (^add)(NSNumber *, NSNumber *) = ^(NSNumber *left, NSNumber *right) {
+			return @(left.longLongValue + right.longLongValue);
+		};
+
+		NSNumber *sum = [values.rac_sequence parallelReduceWithIdentity:@0 combine:add];
+		expect(sum).to(equal([values.rac_sequence foldLeftWithStart:@0 reduce:add]));
+	});
+
+	qck_it(@"should reduce chunks in order", ^{
+		NSArray *letters = [[values.rac_sequence take:1000] map:^(NSNumber *value) {
+			return [NSString stringWithFormat:@"%c", 'a' + (char)(value.integerValue % 26)];
+		}].array;
+
+		// Concatenation is associative, but not commutative.
+		id (^concatenate)(NSString *, NSString *) = ^(NSString *left, NSString *right) {
+			return [left stringByAppendingString:right];
+		};
+
+		NSString *result = [letters.rac_sequence parallelReduceWithIdentity:@"" combine:concatenate];
+		expect(result).to(equal([letters componentsJoinedByString:@""]));
+	});
+
+	qck_it(@"should return the identity for an empty sequence", ^{
+		id result = [RACSequence.empty parallelReduceWithIdentity:@0 combine:^ id (id left, id right) {
+			return nil;
+		}];
+
+		expect(result).to(equal(@0));
+	});
+
+	qck_it(@"should map and filter empty sequences", ^{
+		RACSequence *mapped = [RACSequence.empty parallelMap:^(id value) {
+			return value;
+		}];
+
+		RACSequence *filtered = [@[].rac_sequence parallelFilter:^(id _) {
+			return YES;
+		}];
+
+		expect(mapped.array).to(equal(@[]));
+		expect(filtered.array).to(equal(@[]));
+	});
+
+	qck_it(@"should chain after filtering out every value", ^{
+		RACSequence *filtered = [values.rac_sequence parallelFilter:^(id _) {
+			return NO;
+		}];
+
+		RACSequence *mapped = [filtered parallelMap:^(id value) {
+			return value;
+		}];
+
+		expect(mapped.array).to(equal(@[]));
+	});
 });
 
 qck_describe(@"-any", ^{
@@ -16,12 +16,14 @@
 
 #import "EXTKeyPathCoding.h"
 #import "NSObject+RACDeallocating.h"
+#import "NSObject+RACDescription.h"
 #import "NSObject+RACPropertySubscribing.h"
 #import "RACBehaviorSubject.h"
 #import "RACCommand.h"
 #import "RACCompoundDisposable.h"
 #import "RACDisposable.h"
 #import "RACEvent.h"
+#import "RACFusedSignal.h"
 #import "RACGroupedSignal.h"
 #import "RACMulticastConnection.h"
 #import "RACReplaySubject.h"
@@ -202,6 +204,95 @@ qck_describe(@"-bind:", ^{
 		expect(lastValue).to(equal(@2));
 	});
 
+	qck_it(@"should wait for inner signals after a synchronous source stops", ^{
+		__block BOOL completed = NO;
+		__block NSUInteger bindingCount = 0;
+
+		RACSubject *inner = [RACSubject subject];
+		RACSignal *bind = [[RACSignal createSignal:^ id (id<RACSubscriber> subscriber) {
+			[subscriber sendNext:@0];
+			[subscriber sendNext:@1];
+			[subscriber sendNext:@2];
+			[subscriber sendCompleted];
+			return nil;
+		}] bind:^{
+			return ^ RACSignal * (NSNumber *x, BOOL *stop) {
+				bindingCount++;
+				return (x.integerValue == 0 ? inner : nil);
+			};
+		}];
+
+		[bind subscribeCompleted:^{
+			completed = YES;
+		}];
+
+		// The source should be ignored after the binding block returns nil.
+		expect(@(bindingCount)).to(equal(@2));
+		expect(@(completed)).to(beFalsy());
+
+		[inner sendCompleted];
+		expect(@(completed)).to(beTruthy());
+	});
+
+	qck_it(@"should forward +return: and +empty signals synchronously", ^{
+		NSMutableArray *received = [NSMutableArray array];
+		__block BOOL completed = NO;
+
+		RACSubject *inner = [RACSubject subject];
+		RACSignal *bind = [[RACSignal createSignal:^ id (id<RACSubscriber> subscriber) {
+			[subscriber sendNext:@0];
+			[subscriber sendNext:@1];
+			[subscriber sendNext:@2];
+			[subscriber sendCompleted];
+			return nil;
+		}] bind:^{
+			return ^(NSNumber *x, BOOL *stop) {
+				switch (x.integerValue) {
+					case 0: return [RACSignal return:@"foo"];
+					case 1: return [RACSignal empty];
+					default: return (RACSignal *)inner;
+				}
+			};
+		}];
+
+		[bind subscribeNext:^(id x) {
+			[received addObject:x];
+		} completed:^{
+			completed = YES;
+		}];
+
+		expect(received).to(equal(@[ @"foo" ]));
+		expect(@(completed)).to(beFalsy());
+
+		[inner sendNext:@"bar"];
+		[inner sendCompleted];
+
+		expect(received).to(equal(@[ @"foo", @"bar" ]));
+		expect(@(completed)).to(beTruthy());
+	});
+
+	qck_it(@"should not complete when stopped while inner signals are active", ^{
+		__block BOOL completed = NO;
+		[[[signals bind:^{
+			return ^(RACTuple *x, BOOL *stop) {
+				RACTupleUnpack(RACSignal *signal, NSNumber *stopValue) = x;
+				*stop = stopValue.boolValue;
+				return signal;
+			};
+		}] ignoreValues] subscribeCompleted:^{
+			completed = YES;
+		}];
+
+		RACSubject *inner = [RACSubject subject];
+		[signals sendNext:RACTuplePack(inner, @NO)];
+		[signals sendNext:RACTuplePack([RACSignal return:@1], @YES)];
+		[signals sendCompleted];
+		expect(@(completed)).to(beFalsy());
+
+		[inner sendCompleted];
+		expect(@(completed)).to(beTruthy());
+	});
+
 	qck_it(@"should properly stop subscribing to new signals after error", ^{
 		RACSignal *signal = [RACSignal createSignal:^ id (id<RACSubscriber> subscriber) {
 			[subscriber sendNext:@0];
@@ -253,6 +344,167 @@ qck_describe(@"-bind:", ^{
 	});
 });
 
+qck_describe(@"fused operators", ^{
+	__block RACSubject *subject;
+	__block NSUInteger subscriptionCount;
+	__block BOOL disposed;
+	__block RACSignal *source;
+
+	qck_beforeEach(^{
+		subject = [RACSubject subject];
+		subscriptionCount = 0;
+		disposed = NO;
+
+		source = [RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+			subscriptionCount++;
+			[subject subscribe:subscriber];
+
+			return [RACDisposable disposableWithBlock:^{
+				disposed = YES;
+			}];
+		}];
+	});
+
+	qck_it(@"should collapse a chain of operators into one signal", ^{
+		RACSignal *chain = [[[[source map:^(NSNumber *x) {
+			return @(x.integerValue * 2);
+		}] filter:^ BOOL (NSNumber *x) {
+			return x.integerValue > 2;
+		}] skip:1] take:2];
+
+		expect(chain).to(beAKindOf(RACFusedSignal.class));
+	});
+
+	qck_it(@"should apply each operator in order", ^{
+		RACSignal *chain = [[[[[[source
+			map:^(NSNumber *x) {
+				return @(x.integerValue * 2);
+			}]
+			filter:^ BOOL (NSNumber *x) {
+				return x.integerValue > 2;
+			}]
+			distinctUntilChanged]
+			ignore:@8]
+			skip:1]
+			take:2];
+
+		NSMutableArray *values = [NSMutableArray array];
+		__block BOOL completed = NO;
+		[chain subscribeNext:^(id x) {
+			[values addObject:x];
+		} completed:^{
+			completed = YES;
+		}];
+
+		for (NSNumber *value in @[ @1, @2, @3, @3, @4, @5, @6, @7 ]) {
+			[subject sendNext:value];
+		}
+
+		expect(values).to(equal(@[ @6, @10 ]));
+		expect(@(completed)).to(beTruthy());
+		expect(@(disposed)).to(beTruthy());
+		expect(@(subscriptionCount)).to(equal(@1));
+	});
+
+	qck_it(@"should keep separate state for each subscription", ^{
+		RACSignal *chain = [[source skip:1] take:1];
+
+		NSMutableArray *firstValues = [NSMutableArray array];
+		[chain subscribeNext:^(id x) {
+			[firstValues addObject:x];
+		}];
+
+		[subject sendNext:@1];
+
+		NSMutableArray *secondValues = [NSMutableArray array];
+		[chain subscribeNext:^(id x) {
+			[secondValues addObject:x];
+		}];
+
+		[subject sendNext:@2];
+		[subject sendNext:@3];
+
+		expect(firstValues).to(equal(@[ @2 ]));
+		expect(secondValues).to(equal(@[ @3 ]));
+		expect(@(subscriptionCount)).to(equal(@2));
+	});
+
+	qck_it(@"should not change the receiver when extended", ^{
+		RACSignal *mapped = [source map:^(NSNumber *x) {
+			return @(x.integerValue + 1);
+		}];
+
+		RACSignal *filtered = [mapped filter:^ BOOL (NSNumber *x) {
+			return NO;
+		}];
+
+		NSMutableArray *mappedValues = [NSMutableArray array];
+		[mapped subscribeNext:^(id x) {
+			[mappedValues addObject:x];
+		}];
+
+		NSMutableArray *filteredValues = [NSMutableArray array];
+		[filtered subscribeNext:^(id x) {
+			[filteredValues addObject:x];
+		}];
+
+		[subject sendNext:@1];
+
+		expect(mappedValues).to(equal(@[ @2 ]));
+		expect(filteredValues).to(equal(@[]));
+	});
+
+	qck_it(@"should fuse -mapReplace:, -reduceEach: and -scanWithStart:reduce:", ^{
+		RACSignal *chain = [[[[source
+			map:^(NSNumber *x) {
+				return RACTuplePack(x, @10);
+			}]
+			reduceEach:^(NSNumber *x, NSNumber *y) {
+				return @(x.integerValue * y.integerValue);
+			}]
+			scanWithStart:@0 reduce:^(NSNumber *running, NSNumber *next) {
+				return @(running.integerValue + next.integerValue);
+			}]
+			take:3];
+
+		expect(chain).to(beAKindOf(RACFusedSignal.class));
+
+		NSMutableArray *values = [NSMutableArray array];
+		[chain subscribeNext:^(id x) {
+			[values addObject:x];
+		}];
+
+		NSMutableArray *replacedValues = [NSMutableArray array];
+		[[chain mapReplace:@"foo"] subscribeNext:^(id x) {
+			[replacedValues addObject:x];
+		}];
+
+		[subject sendNext:@1];
+		[subject sendNext:@2];
+		[subject sendNext:@3];
+		[subject sendNext:@4];
+
+		expect(values).to(equal(@[ @10, @30, @60 ]));
+		expect(replacedValues).to(equal(@[ @"foo", @"foo", @"foo" ]));
+		expect(@(subscriptionCount)).to(equal(@2));
+	});
+
+	qck_it(@"should forward errors", ^{
+		__block NSError *receivedError = nil;
+		[[source map:^(id x) {
+			return x;
+		}] subscribeError:^(NSError *error) {
+			receivedError = error;
+		}];
+
+		NSError *error = [NSError errorWithDomain:@"RACSignalSpec" code:1 userInfo:nil];
+		[subject sendError:error];
+
+		expect(receivedError).to(equal(error));
+		expect(@(disposed)).to(beTruthy());
+	});
+});
+
 qck_describe(@"subscribing", ^{
 	__block RACSignal *signal = nil;
 	id nextValueSent = @"1";
@@ -1083,6 +1335,35 @@ qck_describe(@"+combineLatest:", ^{
 		[subject3 sendCompleted];
 		expect(@(completed)).to(beTruthy());
 	});
+
+	qck_it(@"should combine many signals into flat tuples", ^{
+		NSMutableArray *subjects = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 32; i++) {
+			[subjects addObject:[RACSubject subject]];
+		}
+
+		NSMutableArray *tuples = [NSMutableArray array];
+		[[RACSignal combineLatest:subjects] subscribeNext:^(id x) {
+			[tuples addObject:x];
+		}];
+
+		NSMutableArray *expected = [NSMutableArray array];
+		for (NSUInteger i = 0; i < subjects.count; i++) {
+			expect(@(tuples.count)).to(equal(@0));
+
+			[subjects[i] sendNext:(i == 1 ? nil : @(i))];
+			[expected addObject:(i == 1 ? RACTupleNil.tupleNil : @(i))];
+		}
+
+		expect(tuples).to(equal(@[ [RACTuple tupleWithObjectsFromArray:expected] ]));
+
+		[subjects.lastObject sendNext:@"foo"];
+		expected[subjects.count - 1] = @"foo";
+
+		expect(@(tuples.count)).to(equal(@2));
+		expect(tuples.lastObject).to(equal([RACTuple tupleWithObjectsFromArray:expected]));
+		expect([tuples.lastObject second]).to(beNil());
+	});
 });
 
 qck_describe(@"+combineLatest:reduce:", ^{
@@ -1839,6 +2120,39 @@ qck_describe(@"-flatten:", ^{
 		[signalsSubject sendCompleted];
 	});
 
+	qck_it(@"should start many queued signals in order", ^{
+		RACSubject *signals = [RACSubject subject];
+
+		NSMutableArray *values = [NSMutableArray array];
+		__block BOOL completed = NO;
+		[[signals flatten:8] subscribeNext:^(id x) {
+			[values addObject:x];
+		} completed:^{
+			completed = YES;
+		}];
+
+		NSMutableArray *subjects = [NSMutableArray array];
+		NSMutableArray *expected = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 10000; i++) {
+			RACSubject *subject = [RACSubject subject];
+			[subjects addObject:subject];
+			[expected addObject:@(i)];
+
+			[signals sendNext:[subject startWith:@(i)]];
+		}
+
+		[signals sendCompleted];
+		expect(@(values.count)).to(equal(@8));
+		expect(@(completed)).to(beFalsy());
+
+		for (RACSubject *subject in subjects) {
+			[subject sendCompleted];
+		}
+
+		expect(values).to(equal(expected));
+		expect(@(completed)).to(beTruthy());
+	});
+
 	qck_it(@"should dispose after last synchronous signal subscription and should not crash", ^{
 
 		RACSignal *flattened = [signalsSubject flatten:1];
@@ -2877,6 +3191,72 @@ qck_describe(@"-then:", ^{
 	});
 });
 
+qck_describe(@"-setNameWithBlock:", ^{
+	__block BOOL namesWereEnabled;
+	__block NSUInteger nameBlockCount;
+	__block RACSignal * (^nameSignal)(void);
+
+	qck_beforeEach(^{
+		namesWereEnabled = RACDebugSignalNamesEnabled();
+		nameBlockCount = 0;
+
+		nameSignal = ^{
+			return [[RACSignal never] setNameWithBlock:^{
+				nameBlockCount++;
+				return @"foo";
+			}];
+		};
+	});
+
+	qck_afterEach(^{
+		RACSetDebugSignalNamesEnabled(namesWereEnabled);
+	});
+
+	qck_it(@"should not invoke the block until the name is read", ^{
+		RACSetDebugSignalNamesEnabled(YES);
+
+		RACSignal *signal = nameSignal();
+		expect(@(nameBlockCount)).to(equal(@0));
+
+		expect(signal.name).to(equal(@"foo"));
+		expect(@(nameBlockCount)).to(equal(@1));
+	});
+
+	qck_it(@"should only invoke the block once", ^{
+		RACSetDebugSignalNamesEnabled(YES);
+
+		RACSignal *signal = nameSignal();
+		expect(signal.name).to(equal(@"foo"));
+		expect(signal.name).to(equal(@"foo"));
+		expect(@(nameBlockCount)).to(equal(@1));
+	});
+
+	qck_it(@"should not use the block when names are disabled", ^{
+		RACSetDebugSignalNamesEnabled(NO);
+
+		RACSignal *signal = nameSignal();
+		expect(@([signal.name isEqual:@"foo"])).to(beFalsy());
+		expect(@(nameBlockCount)).to(equal(@0));
+	});
+
+	qck_it(@"should not keep the source of -replay alive", ^{
+		RACSetDebugSignalNamesEnabled(YES);
+
+		__weak RACSubject *weakSubject;
+		RACSignal *replayed;
+
+		@autoreleasepool {
+			RACSubject *subject = [RACSubject subject];
+			weakSubject = subject;
+
+			replayed = [subject replay];
+		}
+
+		expect(weakSubject).to(beNil());
+		expect(replayed).notTo(beNil());
+	});
+});
+
 qck_describe(@"-sequence", ^{
 	RACSignal *signal = [RACSignal createSignal:^ RACDisposable * (id<RACSubscriber> subscriber) {
 		[subscriber sendNext:@1];
@@ -2980,6 +3360,42 @@ qck_describe(@"+zip:", ^{
 		expect(@(hasSentCompleted)).to(beTruthy());
 	});
 
+	qck_it(@"should zip many signals into flat tuples", ^{
+		NSMutableArray *subjects = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 32; i++) {
+			[subjects addObject:[RACSubject subject]];
+		}
+
+		NSMutableArray *tuples = [NSMutableArray array];
+		__block BOOL completed = NO;
+		[[RACSignal zip:subjects] subscribeNext:^(id x) {
+			[tuples addObject:x];
+		} completed:^{
+			completed = YES;
+		}];
+
+		NSMutableArray *firstValues = [NSMutableArray array];
+		NSMutableArray *secondValues = [NSMutableArray array];
+		for (NSUInteger i = 0; i < subjects.count; i++) {
+			[subjects[i] sendNext:@(i)];
+			[subjects[i] sendNext:@(i * 2)];
+
+			[firstValues addObject:@(i)];
+			[secondValues addObject:@(i * 2)];
+		}
+
+		NSArray *expected = @[
+			[RACTuple tupleWithObjectsFromArray:firstValues],
+			[RACTuple tupleWithObjectsFromArray:secondValues],
+		];
+
+		expect(tuples).to(equal(expected));
+		expect(@(completed)).to(beFalsy());
+
+		[subjects[3] sendCompleted];
+		expect(@(completed)).to(beTruthy());
+	});
+
 	qck_it(@"should forward errors sent earlier than (time-wise) and before (position-wise) a complete", ^{
 		send2NextAndErrorTo1();
 		send3NextAndCompletedTo2();
@@ -55,6 +55,48 @@ qck_describe(@"RACSubject", ^{
 			RACSubscriberExampleSuccessBlock: [^{ return success; } copy]
 		};
 	});
+
+	qck_it(@"should only send values to subscribers which haven't been disposed", ^{
+		NSMutableArray *disposables = [NSMutableArray array];
+		NSMutableArray *receivedCounts = [NSMutableArray array];
+
+		for (NSUInteger i = 0; i < 5; i++) {
+			[receivedCounts addObject:@0];
+
+			RACDisposable *disposable = [subject subscribeNext:^(id _) {
+				receivedCounts[i] = @([receivedCounts[i] unsignedIntegerValue] + 1);
+			}];
+
+			[disposables addObject:disposable];
+		}
+
+		[subject sendNext:@1];
+
+		// Dispose from the middle and from the end of the list.
+		[disposables[2] dispose];
+		[disposables[4] dispose];
+
+		[subject sendNext:@2];
+
+		expect(receivedCounts).to(equal(@[ @2, @2, @1, @2, @1 ]));
+		expect(values).to(equal(@[ @1, @2 ]));
+	});
+
+	qck_it(@"should send values to subscribers added while sending", ^{
+		__block NSUInteger laterCount = 0;
+
+		[[subject take:1] subscribeNext:^(id _) {
+			[subject subscribeNext:^(id _) {
+				laterCount++;
+			}];
+		}];
+
+		[subject sendNext:@1];
+		expect(@(laterCount)).to(equal(@0));
+
+		[subject sendNext:@2];
+		expect(@(laterCount)).to(equal(@1));
+	});
 });
 
 qck_describe(@"RACReplaySubject", ^{
@@ -141,6 +183,73 @@ qck_describe(@"RACReplaySubject", ^{
 		});
 	});
 
+	qck_describe(@"with a capacity of 3", ^{
+		qck_beforeEach(^{
+			subject = [RACReplaySubject replaySubjectWithCapacity:3];
+		});
+
+		qck_it(@"should not skip values trimmed while replaying to a new subscriber", ^{
+			NSMutableArray *values = [NSMutableArray array];
+
+			dispatch_semaphore_t replayStarted = dispatch_semaphore_create(0);
+			dispatch_semaphore_t valuesSent = dispatch_semaphore_create(0);
+
+			[subject sendNext:@0];
+			[subject sendNext:@1];
+			[subject sendNext:@2];
+
+			dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+				[subject subscribeNext:^(id x) {
+					[values addObject:x];
+					if (![x isEqual:@0]) return;
+
+					dispatch_semaphore_signal(replayStarted);
+					dispatch_semaphore_wait(valuesSent, DISPATCH_TIME_FOREVER);
+				}];
+			});
+
+			dispatch_semaphore_wait(replayStarted, DISPATCH_TIME_FOREVER);
+
+			// Overrun the buffer while the first replayed value is being
+			// delivered.
+			for (NSUInteger i = 3; i < 10; i++) {
+				[subject sendNext:@(i)];
+			}
+
+			dispatch_semaphore_signal(valuesSent);
+
+			expect(values).toEventually(equal(@[ @0, @1, @2, @3, @4, @5, @6, @7, @8, @9 ]));
+		});
+
+		qck_it(@"should send the last values in order after wrapping around", ^{
+			for (NSUInteger i = 0; i < 10; i++) {
+				[subject sendNext:@(i)];
+			}
+
+			[subject sendCompleted];
+			expect(subject.toArray).to(equal(@[ @7, @8, @9 ]));
+		});
+
+		qck_it(@"should send fewer values than its capacity", ^{
+			[subject sendNext:@0];
+			[subject sendNext:nil];
+			[subject sendCompleted];
+
+			expect(subject.toArray).to(equal(@[ @0, NSNull.null ]));
+		});
+	});
+
+	qck_describe(@"with a capacity of 0", ^{
+		qck_it(@"should not replay any values", ^{
+			subject = [RACReplaySubject replaySubjectWithCapacity:0];
+
+			[subject sendNext:@0];
+			[subject sendCompleted];
+
+			expect(subject.toArray).to(equal(@[]));
+		});
+	});
+
 	qck_describe(@"with an unlimited capacity", ^{
 		qck_beforeEach(^{
 			subject = [RACReplaySubject subject];
@@ -283,6 +392,36 @@ qck_describe(@"RACReplaySubject", ^{
 			expect(values).toEventually(equal(@[ @0 ]));
 		});
 
+		qck_it(@"should not block senders while replaying to a new subscriber", ^{
+			NSMutableArray *values = [NSMutableArray array];
+
+			dispatch_semaphore_t replayStarted = dispatch_semaphore_create(0);
+			dispatch_semaphore_t valuesSent = dispatch_semaphore_create(0);
+
+			[subject sendNext:@0];
+
+			dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+				[subject subscribeNext:^(id x) {
+					[values addObject:x];
+					if (![x isEqual:@0]) return;
+
+					dispatch_semaphore_signal(replayStarted);
+					dispatch_semaphore_wait(valuesSent, DISPATCH_TIME_FOREVER);
+				}];
+			});
+
+			dispatch_semaphore_wait(replayStarted, DISPATCH_TIME_FOREVER);
+
+			// These would deadlock if the subject were locked while replaying.
+			[subject sendNext:@1];
+			[subject sendNext:@2];
+			dispatch_semaphore_signal(valuesSent);
+
+			[subject sendNext:@3];
+
+			expect(values).toEventually(equal(@[ @0, @1, @2, @3 ]));
+		});
+
 		qck_it(@"should finish replaying before completing", ^{
 			[subject sendNext:@1];
 
@@ -135,6 +135,25 @@ qck_it(@"should execute delayed blocks in date order when stepping", ^{
 	expect(@(laterExecuted)).to(beTruthy());
 });
 
+qck_it(@"should order blocks scheduled in nanoseconds with blocks scheduled at dates", ^{
+	NSMutableArray *order = [NSMutableArray array];
+
+	[scheduler afterNanoseconds:30 * NSEC_PER_SEC schedule:^{
+		[order addObject:@3];
+	}];
+
+	[scheduler after:[NSDate dateWithTimeIntervalSinceNow:20] schedule:^{
+		[order addObject:@2];
+	}];
+
+	[scheduler afterNanoseconds:10 * NSEC_PER_SEC schedule:^{
+		[order addObject:@1];
+	}];
+
+	[scheduler stepAll];
+	expect(order).to(equal((@[ @1, @2, @3 ])));
+});
+
 qck_it(@"should execute a repeating blocks in date order", ^{
 	__block NSUInteger firstExecutions = 0;
 	[scheduler after:[NSDate dateWithTimeIntervalSinceNow:20] repeatingEvery:5 withLeeway:0 schedule:^{
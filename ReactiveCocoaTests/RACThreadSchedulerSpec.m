@@ -0,0 +1,157 @@
+//
+//  RACThreadSchedulerSpec.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Quick/Quick.h>
+#import <Nimble/Nimble.h>
+
+#import "RACDisposable.h"
+#import "RACThreadScheduler.h"
+#import <libkern/OSAtomic.h>
+
+QuickSpecBegin(RACThreadSchedulerSpec)
+
+__block RACScheduler *scheduler;
+
+qck_beforeEach(^{
+	scheduler = [[RACThreadScheduler alloc] initWithName:@"test-scheduler"];
+});
+
+qck_it(@"should have a valid current scheduler", ^{
+	__block RACScheduler *currentScheduler;
+	[scheduler schedule:^{
+		currentScheduler = RACScheduler.currentScheduler;
+	}];
+
+	expect(currentScheduler).toEventually(equal(scheduler));
+});
+
+qck_it(@"should run blocks on its own thread", ^{
+	__block NSString *threadName;
+	[scheduler schedule:^{
+		threadName = NSThread.currentThread.name;
+	}];
+
+	expect(threadName).toEventually(equal(@"test-scheduler"));
+});
+
+qck_it(@"should run blocks FIFO", ^{
+	NSMutableArray *values = [NSMutableArray array];
+	NSMutableArray *expectedValues = [NSMutableArray array];
+
+	for (NSUInteger i = 0; i < 1000; i++) {
+		[expectedValues addObject:@(i)];
+
+		[scheduler schedule:^{
+			[values addObject:@(i)];
+		}];
+	}
+
+	__block BOOL done = NO;
+	[scheduler schedule:^{
+		done = YES;
+	}];
+
+	expect(@(done)).toEventually(beTruthy());
+	expect(values).to(equal(expectedValues));
+});
+
+qck_it(@"should run every block scheduled concurrently from many threads", ^{
+	const int32_t blocksPerThread = 5000;
+	const int32_t threadCount = 8;
+
+	__block int32_t runCount = 0;
+	__block BOOL runConcurrently = NO;
+	__block volatile int32_t running = 0;
+
+	dispatch_apply(threadCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t _) {
+		for (int32_t i = 0; i < blocksPerThread; i++) {
+			[scheduler schedule:^{
+				if (OSAtomicIncrement32Barrier(&running) != 1) runConcurrently = YES;
+
+				runCount++;
+
+				OSAtomicDecrement32Barrier(&running);
+			}];
+		}
+	});
+
+	expect(@(runCount)).toEventually(equal(@(blocksPerThread * threadCount)));
+	expect(@(runConcurrently)).to(beFalsy());
+});
+
+qck_it(@"should cancel scheduled blocks when disposed", ^{
+	__block BOOL firstBlockRan = NO;
+	__block BOOL secondBlockRan = NO;
+
+	// Start off on the scheduler so the enqueued blocks won't run until we
+	// return.
+	[scheduler schedule:^{
+		RACDisposable *disposable = [scheduler schedule:^{
+			firstBlockRan = YES;
+		}];
+
+		[scheduler schedule:^{
+			secondBlockRan = YES;
+		}];
+
+		[disposable dispose];
+	}];
+
+	expect(@(secondBlockRan)).toEventually(beTruthy());
+	expect(@(firstBlockRan)).to(beFalsy());
+});
+
+qck_it(@"should schedule future blocks", ^{
+	__block BOOL done = NO;
+
+	[scheduler after:[NSDate dateWithTimeIntervalSinceNow:0.01] schedule:^{
+		done = YES;
+	}];
+
+	expect(@(done)).to(beFalsy());
+	expect(@(done)).toEventually(beTruthy());
+});
+
+qck_it(@"should schedule recurring blocks", ^{
+	__block NSUInteger count = 0;
+
+	RACDisposable *disposable = [scheduler after:[NSDate date] repeatingEvery:0.05 withLeeway:0 schedule:^{
+		count++;
+	}];
+
+	expect(@(count)).toEventually(beGreaterThanOrEqualTo(@3));
+
+	[disposable dispose];
+	[NSThread sleepForTimeInterval:0.1];
+
+	NSUInteger finalCount = count;
+	[NSThread sleepForTimeInterval:0.1];
+
+	expect(@(count)).to(equal(@(finalCount)));
+});
+
+qck_it(@"should stop its thread when deallocated", ^{
+	__block NSThread *thread;
+	__weak RACScheduler *weakScheduler;
+
+	@autoreleasepool {
+		RACScheduler *localScheduler = [[RACThreadScheduler alloc] initWithName:@"short-lived-scheduler"];
+		weakScheduler = localScheduler;
+
+		[localScheduler schedule:^{
+			thread = NSThread.currentThread;
+		}];
+
+		expect(thread).toEventuallyNot(beNil());
+	}
+
+	expect(weakScheduler).toEventually(beNil());
+	expect(@(thread.finished)).toEventually(beTruthy());
+});
+
+QuickSpecEnd
@@ -0,0 +1,168 @@
+//
+//  RACTimingWheelSchedulerSpec.m
+//  ReactiveCocoa
+//
+//  Created by agent on 2026-10-16.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Quick/Quick.h>
+#import <Nimble/Nimble.h>
+
+#import "RACDisposable.h"
+#import "RACTimingWheelScheduler.h"
+
+QuickSpecBegin(RACTimingWheelSchedulerSpec)
+
+__block RACTimingWheelScheduler *scheduler;
+
+qck_beforeEach(^{
+	scheduler = [[RACTimingWheelScheduler alloc] initWithName:@"test-scheduler" targetQueue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0) resolution:0.001];
+});
+
+qck_it(@"should default to a resolution of 10 milliseconds", ^{
+	RACTimingWheelScheduler *defaultScheduler = [[RACTimingWheelScheduler alloc] initWithName:nil targetQueue:dispatch_get_main_queue()];
+	expect(@(defaultScheduler.resolution)).to(equal(@0.01));
+});
+
+qck_it(@"should schedule future blocks", ^{
+	__block BOOL done = NO;
+
+	[scheduler after:[NSDate dateWithTimeIntervalSinceNow:0.01] schedule:^{
+		done = YES;
+	}];
+
+	expect(@(done)).to(beFalsy());
+	expect(@(done)).toEventually(beTruthy());
+});
+
+qck_it(@"should have a valid current scheduler in future blocks", ^{
+	__block RACScheduler *currentScheduler;
+	[scheduler afterDelay:0.01 schedule:^{
+		currentScheduler = RACScheduler.currentScheduler;
+	}];
+
+	expect(currentScheduler).toEventually(equal(scheduler));
+});
+
+qck_it(@"should run future blocks in order of their deadlines", ^{
+	NSMutableArray *values = [NSMutableArray array];
+
+	// Cover several levels of the wheel.
+	NSArray *delays = @[ @0.4, @0.002, @0.3, @0.05, @0.2, @0.001, @0.1, @0.26 ];
+	for (NSNumber *delay in delays) {
+		[scheduler afterDelay:delay.doubleValue schedule:^{
+			[values addObject:delay];
+		}];
+	}
+
+	NSArray *expected = [delays sortedArrayUsingSelector:@selector(compare:)];
+	expect(values).toEventually(equal(expected));
+});
+
+qck_it(@"should not run future blocks before their deadlines", ^{
+	NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:0.3];
+	__block NSDate *ranDate;
+
+	[scheduler after:deadline schedule:^{
+		ranDate = [NSDate date];
+	}];
+
+	expect(ranDate).toEventuallyNot(beNil());
+	expect(@([ranDate timeIntervalSinceDate:deadline])).to(beGreaterThanOrEqualTo(@0));
+});
+
+qck_it(@"should honor deadlines of blocks scheduled after being idle", ^{
+	__block BOOL firstDone = NO;
+	[scheduler afterDelay:0.005 schedule:^{
+		firstDone = YES;
+	}];
+
+	expect(@(firstDone)).toEventually(beTruthy());
+
+	// Let the wheel fall behind the clock while it has no entries.
+	[NSThread sleepForTimeInterval:0.2];
+
+	__block BOOL secondDone = NO;
+	[scheduler afterDelay:0.05 schedule:^{
+		secondDone = YES;
+	}];
+
+	[NSThread sleepForTimeInterval:0.02];
+	expect(@(secondDone)).to(beFalsy());
+	expect(@(secondDone)).toEventually(beTruthy());
+});
+
+qck_it(@"should cancel future blocks when disposed", ^{
+	__block BOOL firstBlockRan = NO;
+	__block BOOL secondBlockRan = NO;
+
+	RACDisposable *disposable = [scheduler afterDelay:0.01 schedule:^{
+		firstBlockRan = YES;
+	}];
+
+	[scheduler afterDelay:0.02 schedule:^{
+		secondBlockRan = YES;
+	}];
+
+	[disposable dispose];
+
+	expect(@(secondBlockRan)).toEventually(beTruthy());
+	expect(@(firstBlockRan)).to(beFalsy());
+});
+
+qck_it(@"should run many future blocks", ^{
+	__block NSUInteger runCount = 0;
+	NSUInteger blockCount = 20000;
+
+	NSMutableArray *disposables = [NSMutableArray array];
+	for (NSUInteger i = 0; i < blockCount; i++) {
+		[disposables addObject:[scheduler afterDelay:0.05 + (i % 100) * 0.001 schedule:^{
+			runCount++;
+		}]];
+	}
+
+	// Cancel every other block, as timeouts usually are.
+	for (NSUInteger i = 0; i < blockCount; i += 2) {
+		[disposables[i] dispose];
+	}
+
+	expect(@(runCount)).toEventually(equal(@(blockCount / 2)));
+});
+
+qck_it(@"should schedule recurring blocks", ^{
+	__block NSUInteger count = 0;
+
+	RACDisposable *disposable = [scheduler after:[NSDate date] repeatingEvery:0.05 withLeeway:0 schedule:^{
+		count++;
+	}];
+
+	expect(@(count)).toEventually(beGreaterThanOrEqualTo(@3));
+
+	[disposable dispose];
+	[NSThread sleepForTimeInterval:0.1];
+
+	NSUInteger finalCount = count;
+	[NSThread sleepForTimeInterval:0.1];
+
+	expect(@(count)).to(equal(@(finalCount)));
+});
+
+qck_it(@"should be deallocated once its future blocks have run", ^{
+	__block BOOL done = NO;
+	__weak RACScheduler *weakScheduler;
+
+	@autoreleasepool {
+		RACScheduler *localScheduler = [[RACTimingWheelScheduler alloc] initWithName:nil targetQueue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)];
+		weakScheduler = localScheduler;
+
+		[localScheduler afterDelay:0.01 schedule:^{
+			done = YES;
+		}];
+	}
+
+	expect(@(done)).toEventually(beTruthy());
+	expect(weakScheduler).toEventually(beNil());
+});
+
+QuickSpecEnd